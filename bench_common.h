@@ -0,0 +1,143 @@
+/*
+ * Phoenix-RTOS
+ *
+ * phoenix-rtos-tests
+ *
+ * Common benchmark helpers - timing and latency statistics
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+
+typedef struct {
+	uint32_t *samples; /* Latency samples in usec */
+	unsigned int size; /* Max number of samples */
+	unsigned int n;    /* Number of collected samples */
+	uint64_t sum;      /* Sum of collected samples */
+} bench_stats_t;
+
+
+/* Returns current time in usec */
+static inline uint64_t bench_now(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+
+	return (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+
+/* Returns number of events per second */
+static inline uint64_t bench_rate(uint64_t count, uint64_t time)
+{
+	return (time == 0) ? 0 : (count * 1000000) / time;
+}
+
+
+static inline int bench_statsInit(bench_stats_t *stats, unsigned int size)
+{
+	stats->size = size;
+	stats->n = 0;
+	stats->sum = 0;
+
+	if ((stats->samples = malloc(size * sizeof(*stats->samples))) == NULL)
+		return -1;
+
+	return 0;
+}
+
+
+static inline void bench_statsFree(bench_stats_t *stats)
+{
+	free(stats->samples);
+	stats->samples = NULL;
+	stats->size = 0;
+	stats->n = 0;
+}
+
+
+static inline void bench_statsReset(bench_stats_t *stats)
+{
+	stats->n = 0;
+	stats->sum = 0;
+}
+
+
+/* Adds sample, samples over stats capacity are silently dropped */
+static inline void bench_statsAdd(bench_stats_t *stats, uint64_t time)
+{
+	if (stats->n >= stats->size)
+		return;
+
+	stats->samples[stats->n++] = (time > UINT32_MAX) ? UINT32_MAX : (uint32_t)time;
+	stats->sum += time;
+}
+
+
+/* Appends all samples from src to dst */
+static inline void bench_statsMerge(bench_stats_t *dst, const bench_stats_t *src)
+{
+	unsigned int i;
+
+	for (i = 0; i < src->n; i++)
+		bench_statsAdd(dst, src->samples[i]);
+}
+
+
+static inline int bench_cmp(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+
+/* Sorts samples, has to be called before bench_statsPct() */
+static inline void bench_statsSort(bench_stats_t *stats)
+{
+	qsort(stats->samples, stats->n, sizeof(*stats->samples), bench_cmp);
+}
+
+
+/* Returns pct percentile (0-100) of sorted samples */
+static inline uint32_t bench_statsPct(const bench_stats_t *stats, unsigned int pct)
+{
+	unsigned int i;
+
+	if (stats->n == 0)
+		return 0;
+
+	i = (uint64_t)stats->n * pct / 100;
+
+	return stats->samples[(i < stats->n) ? i : stats->n - 1];
+}
+
+
+static inline uint32_t bench_statsAvg(const bench_stats_t *stats)
+{
+	return (stats->n == 0) ? 0 : (uint32_t)(stats->sum / stats->n);
+}
+
+
+/* Prints min/avg/p50/p90/p99/max summary line of sorted samples */
+static inline void bench_statsPrint(const char *prefix, const bench_stats_t *stats)
+{
+	printf("%s min %" PRIu32 " avg %" PRIu32 " p50 %" PRIu32 " p90 %" PRIu32 " p99 %" PRIu32 " max %" PRIu32 " [us]\n", prefix,
+		bench_statsPct(stats, 0), bench_statsAvg(stats), bench_statsPct(stats, 50), bench_statsPct(stats, 90), bench_statsPct(stats, 99), bench_statsPct(stats, 100));
+}
+
+#endif
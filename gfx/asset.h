@@ -0,0 +1,77 @@
+/*
+ * Phoenix-RTOS
+ *
+ * Graphics library test compressed image assets
+ *
+ * Images are stored row by row as sequences of packets (generated by asset.py):
+ * - control byte 0-127   - (control + 1) literal pixels follow,
+ * - control byte 128-255 - single pixel follows, repeated (control - 125) times.
+ * Packets never cross rows, so images can be decoded directly into framebuffer.
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#ifndef _ASSET_H_
+#define _ASSET_H_
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+
+typedef struct {
+	unsigned int width;        /* Image width in pixels */
+	unsigned int height;       /* Image height in pixels */
+	unsigned char depth;       /* Color depth in bytes */
+	unsigned int size;         /* Compressed data size */
+	uint32_t crc;              /* Decoded image CRC32 */
+	const unsigned char *data; /* Compressed image */
+} asset_t;
+
+
+/* Decodes image into dst, dstspan is destination row span in bytes */
+static inline int asset_decode(const asset_t *asset, void *dst, unsigned int dstspan)
+{
+	const unsigned char *src = asset->data, *end = asset->data + asset->size;
+	unsigned int x, y, n, len, k;
+	unsigned char *p;
+
+	for (y = 0; y < asset->height; y++) {
+		p = (unsigned char *)dst + (size_t)y * dstspan;
+
+		for (x = 0; x < asset->width; x += n, p += len) {
+			if (src >= end)
+				return -EINVAL;
+
+			if (*src < 128) {
+				n = *src++ + 1;
+				len = n * asset->depth;
+				if ((x + n > asset->width) || ((size_t)(end - src) < len))
+					return -EINVAL;
+				memcpy(p, src, len);
+				src += len;
+			}
+			else {
+				n = *src++ - 125;
+				len = n * asset->depth;
+				if ((x + n > asset->width) || ((size_t)(end - src) < asset->depth))
+					return -EINVAL;
+				memcpy(p, src, asset->depth);
+				src += asset->depth;
+
+				/* Replicate pixel doubling the copied block */
+				for (k = asset->depth; k < len; k <<= 1)
+					memcpy(p + k, p, (len - k < k) ? len - k : k);
+			}
+		}
+	}
+
+	return (src == end) ? 0 : -EINVAL;
+}
+
+
+#endif
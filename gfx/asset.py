@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+#
+# Phoenix-RTOS
+#
+# Graphics library test compressed image assets generator
+#
+# Compresses raw image (rows of pixels, depth bytes per pixel) and prints
+# C definitions of asset_t image to include in asset header (see asset.h)
+#
+# Copyright 2021 Phoenix Systems
+#
+# %LICENSE%
+#
+
+import argparse
+import sys
+import zlib
+
+
+MAX_LITERAL = 128  # Max number of literal pixels in packet
+MIN_RUN = 3        # Shorter runs are stored as literals
+MAX_RUN = 130      # Max number of repeated pixels in packet
+
+
+def compress_row(pixels):
+    out = bytearray()
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:MAX_LITERAL]
+            del literal[:MAX_LITERAL]
+            out.append(len(chunk) - 1)
+            for pixel in chunk:
+                out.extend(pixel)
+
+    i = 0
+    while i < len(pixels):
+        j = i
+        while j < len(pixels) and pixels[j] == pixels[i] and j - i < MAX_RUN:
+            j += 1
+
+        if j - i >= MIN_RUN:
+            flush()
+            out.append(j - i + 125)
+            out.extend(pixels[i])
+            i = j
+        else:
+            literal.append(pixels[i])
+            i += 1
+
+    flush()
+    return out
+
+
+def compress(raw, width, height, depth):
+    out = bytearray()
+    span = width * depth
+
+    for y in range(height):
+        row = raw[y * span:(y + 1) * span]
+        out.extend(compress_row([row[x:x + depth] for x in range(0, span, depth)]))
+
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generates compressed image asset C definitions")
+    parser.add_argument("name", help="asset variable name")
+    parser.add_argument("width", type=int, help="image width in pixels")
+    parser.add_argument("height", type=int, help="image height in pixels")
+    parser.add_argument("depth", type=int, help="color depth in bytes")
+    parser.add_argument("input", type=argparse.FileType("rb"), help="raw image file")
+    args = parser.parse_args()
+
+    raw = args.input.read()
+    if len(raw) != args.width * args.height * args.depth:
+        sys.exit(f"{args.input.name}: expected {args.width * args.height * args.depth} bytes, got {len(raw)}")
+
+    data = compress(raw, args.width, args.height, args.depth)
+
+    print(f"static const unsigned char {args.name}_data[{len(data)}] = {{")
+    for i in range(0, len(data), 16):
+        print("\t" + ", ".join(f"0x{b:02x}" for b in data[i:i + 16]) + ("," if i + 16 < len(data) else ""))
+    print("};")
+    print()
+    print()
+    print(f"static const asset_t {args.name} = {{")
+    print(f"\t.width = {args.width},")
+    print(f"\t.height = {args.height},")
+    print(f"\t.depth = {args.depth},")
+    print(f"\t.size = sizeof({args.name}_data),")
+    print(f"\t.crc = 0x{zlib.crc32(raw):08x},")
+    print(f"\t.data = {args.name}_data")
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
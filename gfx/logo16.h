@@ -14,7509 +14,370 @@
 #ifndef _LOGO16_H_
 #define _LOGO16_H_
 
+#include "asset.h"
 
-/* 200x150 16-bit (5:6:5 RGB) Phoenix-RTOS logo */
-static const unsigned char logo16[7500][8] = {
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x48, 0xfa, 0x6d, 0xfb, 0x30, 0xfc, 0x34, 0xfd },
-	{ 0x17, 0xfe, 0x9a, 0xfe, 0xdb, 0xfe, 0x1b, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x1c, 0xff },
-	{ 0xba, 0xfe, 0xf7, 0xfd, 0x51, 0xfc, 0x0b, 0xfb },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x0b, 0xfb, 0x51, 0xfc, 0xf7, 0xfd, 0xba, 0xfe },
-	{ 0x1c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x1b, 0xff, 0xdb, 0xfe, 0x9a, 0xfe, 0x17, 0xfe },
-	{ 0x34, 0xfd, 0x30, 0xfc, 0x6d, 0xfb, 0x48, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x68, 0xfa, 0x18, 0xfe },
-	{ 0x7d, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff },
-	{ 0x18, 0xfe, 0x07, 0xfa, 0x27, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x27, 0xfa, 0x07, 0xfa, 0x18, 0xfe },
-	{ 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x7d, 0xff },
-	{ 0x18, 0xfe, 0x68, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x2c, 0xfb, 0x17, 0xfe, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xfb, 0xfe, 0x89, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0xa9, 0xfa, 0xfb, 0xfe, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x17, 0xfe, 0x2c, 0xfb },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x55, 0xfd },
-	{ 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0x69, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x89, 0xfa, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff },
-	{ 0x55, 0xfd, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x27, 0xfa, 0xd7, 0xfd, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xfd },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x34, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xd7, 0xfd, 0x27, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0xdb, 0xfe, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfe, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x38, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x92, 0xfc, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x92, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xfe },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x38, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x38, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x58, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x38, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x71, 0xfc, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0x71, 0xfc, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xdf, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x3c, 0xff, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x3c, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xdf, 0xff, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x1c, 0xff, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x1c, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x9a, 0xfe, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x6d, 0xfb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xdb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x6d, 0xfb },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x75, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xd7, 0xfd, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xd7, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x75, 0xfd },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x6d, 0xfb, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x6d, 0xfb },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x48, 0xfa },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x27, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x92, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0xfc },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x30, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x92, 0xfc, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x96, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x38, 0xfe, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x38, 0xfe, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x96, 0xfd, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x38, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0x55, 0xfd, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x55, 0xfd, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x38, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x9a, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xfb, 0xfe },
-	{ 0x8d, 0xfb, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x8d, 0xfb },
-	{ 0xfb, 0xfe, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x99, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xba, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x55, 0xfd },
-	{ 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd },
-	{ 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd },
-	{ 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd },
-	{ 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd },
-	{ 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd },
-	{ 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd },
-	{ 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd, 0x34, 0xfd },
-	{ 0xb2, 0xfc, 0xef, 0xfb, 0x2c, 0xfb, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x2c, 0xfb, 0xef, 0xfb, 0xb2, 0xfc },
-	{ 0x34, 0xfd, 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd },
-	{ 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd },
-	{ 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd },
-	{ 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd },
-	{ 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd },
-	{ 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd },
-	{ 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd },
-	{ 0x55, 0xfd, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xba, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xdb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xba, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x68, 0xfa },
-	{ 0x0b, 0xfb, 0x2c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb },
-	{ 0x4c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb },
-	{ 0x4c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb },
-	{ 0x2c, 0xfb, 0x27, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x27, 0xfa, 0x2c, 0xfb },
-	{ 0x4c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb },
-	{ 0x4c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb },
-	{ 0x4c, 0xfb, 0x4c, 0xfb, 0x2c, 0xfb, 0x0b, 0xfb },
-	{ 0x68, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x71, 0xfc, 0xba, 0xfe, 0x7d, 0xff },
-	{ 0x9e, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff },
-	{ 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff },
-	{ 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff },
-	{ 0x5d, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x5d, 0xff },
-	{ 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff },
-	{ 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff },
-	{ 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0x9e, 0xff },
-	{ 0x7d, 0xff, 0xba, 0xfe, 0x71, 0xfc, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x8d, 0xfb },
-	{ 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff },
-	{ 0x8d, 0xfb, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x51, 0xfc, 0xdf, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdf, 0xff, 0x51, 0xfc, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x4c, 0xfb, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x4c, 0xfb, 0x07, 0xfa },
-	{ 0x48, 0xfa, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0x48, 0xfa },
-	{ 0xce, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xce, 0xfb },
-	{ 0x75, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x75, 0xfd },
-	{ 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xfe },
-	{ 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff },
-	{ 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff },
-	{ 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xff },
-	{ 0xdb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfe },
-	{ 0xd7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xfd },
-	{ 0x10, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0xfc },
-	{ 0xa9, 0xfa, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xa9, 0xfa },
-	{ 0x07, 0xfa, 0x14, 0xfd, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x14, 0xfd, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xb6, 0xfd, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xb6, 0xfd, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xb6, 0xfd },
-	{ 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff },
-	{ 0xb6, 0xfd, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x4c, 0xfb, 0x96, 0xfd, 0x7d, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xbe, 0xff, 0xea, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xea, 0xfa, 0xbe, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0x7d, 0xff, 0x96, 0xfd, 0x4c, 0xfb },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x48, 0xfa },
-	{ 0x30, 0xfc, 0xd2, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc },
-	{ 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc },
-	{ 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc },
-	{ 0x92, 0xfc, 0x48, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x48, 0xfa, 0x92, 0xfc },
-	{ 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc },
-	{ 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc },
-	{ 0xd3, 0xfc, 0xd3, 0xfc, 0xd2, 0xfc, 0x30, 0xfc },
-	{ 0x48, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x1c, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x1c, 0xff, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x5d, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x5d, 0xff, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x68, 0xfa, 0x7d, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x7d, 0xff, 0x48, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x0b, 0xfb, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0xdb, 0xfe, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0x0b, 0xfb, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xae, 0xfb, 0xdf, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x79, 0xfe, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x38, 0xfe, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdf, 0xff, 0xae, 0xfb, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x14, 0xfd, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xb6, 0xfd, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x54, 0xfd, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0x14, 0xfd, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xb2, 0xfc, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0xef, 0xfb, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x75, 0xfd, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xaa, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x75, 0xfd, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x0f, 0xfc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xbe, 0xff, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x3c, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x0f, 0xfc },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x95, 0xfd },
-	{ 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0x99, 0xfe, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x96, 0xfd, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff },
-	{ 0x75, 0xfd, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x89, 0xfa, 0x0b, 0xfb },
-	{ 0xce, 0xfb, 0x34, 0xfd, 0x5d, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xb2, 0xfc, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xce, 0xfb, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0x5d, 0xff, 0x34, 0xfd, 0xce, 0xfb },
-	{ 0x0b, 0xfb, 0x69, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xef, 0xfb, 0xf7, 0xfd },
-	{ 0xba, 0xfe, 0xfb, 0xfe, 0xfb, 0xfe, 0xfb, 0xfe },
-	{ 0xfb, 0xfe, 0xfb, 0xfe, 0xfb, 0xfe, 0xfb, 0xfe },
-	{ 0xfb, 0xfe, 0xfb, 0xfe, 0xfb, 0xfe, 0xfb, 0xfe },
-	{ 0xfb, 0xfe, 0xfb, 0xfe, 0xfb, 0xfe, 0x1c, 0xff },
-	{ 0x3c, 0xff, 0x5d, 0xff, 0x7d, 0xff, 0x9e, 0xff },
-	{ 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xbe, 0xff, 0x6d, 0xfb, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xaa, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff },
-	{ 0x9e, 0xff, 0x7d, 0xff, 0x5d, 0xff, 0x3c, 0xff },
-	{ 0x1c, 0xff, 0xfb, 0xfe, 0xfb, 0xfe, 0xfb, 0xfe },
-	{ 0xfb, 0xfe, 0xfb, 0xfe, 0xfb, 0xfe, 0xfb, 0xfe },
-	{ 0xfb, 0xfe, 0xfb, 0xfe, 0xfb, 0xfe, 0xfb, 0xfe },
-	{ 0xfb, 0xfe, 0xfb, 0xfe, 0xfb, 0xfe, 0xba, 0xfe },
-	{ 0xf7, 0xfd, 0xef, 0xfb, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x68, 0xfa },
-	{ 0xf3, 0xfc, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x3c, 0xff, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x58, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xf3, 0xfc },
-	{ 0x68, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x27, 0xfa, 0x89, 0xfa, 0x1c, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x91, 0xfc, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x48, 0xfa },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x1c, 0xff, 0x89, 0xfa, 0x27, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x1c, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x18, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0x1c, 0xff, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x79, 0xfe, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0xfc },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x4c, 0xfb, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x79, 0xfe, 0x07, 0xfa },
-	{ 0x4c, 0xfb, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x18, 0xfe, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x4c, 0xfb },
-	{ 0xd2, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xdf, 0xff, 0x89, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x3c, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0xfc },
-	{ 0x58, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0x50, 0xfc, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x6d, 0xfb, 0xdf, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58, 0xfe },
-	{ 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xb6, 0xfd, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xf3, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe },
-	{ 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xfe },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0xd6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff },
-	{ 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xfd },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff },
-	{ 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xd3, 0xfc, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x96, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xff },
-	{ 0x59, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdf, 0xff, 0x6d, 0xfb, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x30, 0xfc, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58, 0xfe },
-	{ 0xd2, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0x1c, 0xff, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x69, 0xfa, 0xdf, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xfc },
-	{ 0x4c, 0xfb, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfd, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x4c, 0xfb },
-	{ 0x07, 0xfa, 0x79, 0xfe, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x4c, 0xfb },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x30, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x79, 0xfe, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x3c, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfd },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0x3c, 0xff, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x27, 0xfa, 0xa9, 0xfa, 0x3c, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x48, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x91, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x3c, 0xff, 0xa9, 0xfa, 0x27, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x69, 0xfa },
-	{ 0xf3, 0xfc, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x38, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x3c, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xf3, 0xfc },
-	{ 0x69, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x10, 0xfc, 0xf7, 0xfd },
-	{ 0xdb, 0xfe, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff },
-	{ 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff },
-	{ 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff },
-	{ 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff },
-	{ 0x3c, 0xff, 0x5d, 0xff, 0x7d, 0xff, 0xbe, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xa9, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x6d, 0xfb, 0xbe, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xbe, 0xff, 0x7d, 0xff, 0x5d, 0xff, 0x3c, 0xff },
-	{ 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff },
-	{ 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff },
-	{ 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff },
-	{ 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0xdb, 0xfe },
-	{ 0xf7, 0xfd, 0x10, 0xfc, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x89, 0xfa, 0x2c, 0xfb },
-	{ 0xce, 0xfb, 0x54, 0xfd, 0x7d, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xce, 0xfb, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xb2, 0xfc, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0x7d, 0xff, 0x54, 0xfd, 0xce, 0xfb },
-	{ 0x2c, 0xfb, 0x89, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x96, 0xfd },
-	{ 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0x96, 0xfd, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x79, 0xfe, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff },
-	{ 0x96, 0xfd, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x10, 0xfc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0x1c, 0xff, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xbe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x10, 0xfc },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x96, 0xfd, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0xaa, 0xfa, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x95, 0xfd, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xcf, 0xfb, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0xb2, 0xfc, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x34, 0xfd, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x54, 0xfd, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0xb6, 0xfd, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0x34, 0xfd, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xae, 0xfb, 0xdf, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x18, 0xfe, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x79, 0xfe, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdf, 0xff, 0xae, 0xfb, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x0b, 0xfb, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xda, 0xfe, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0x0b, 0xfb, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x68, 0xfa, 0x7d, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x7d, 0xff, 0x68, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x5d, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x5d, 0xff, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x1c, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x1c, 0xff, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x0f, 0xfc, 0x91, 0xfc, 0x91, 0xfc, 0x91, 0xfc },
-	{ 0x91, 0xfc, 0x91, 0xfc, 0x91, 0xfc, 0x91, 0xfc },
-	{ 0x91, 0xfc, 0x91, 0xfc, 0x91, 0xfc, 0x91, 0xfc },
-	{ 0x50, 0xfc, 0x48, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x48, 0xfa, 0x50, 0xfc },
-	{ 0x91, 0xfc, 0x91, 0xfc, 0x91, 0xfc, 0x91, 0xfc },
-	{ 0x91, 0xfc, 0x91, 0xfc, 0x91, 0xfc, 0x91, 0xfc },
-	{ 0x91, 0xfc, 0x91, 0xfc, 0x91, 0xfc, 0x0f, 0xfc },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x2c, 0xfb, 0x95, 0xfd, 0x7d, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xbe, 0xff, 0xea, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xea, 0xfa, 0xbe, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0x7d, 0xff, 0x95, 0xfd, 0x2c, 0xfb },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xb6, 0xfd },
-	{ 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff },
-	{ 0xb6, 0xfd, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x96, 0xfd, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0x96, 0xfd, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0xf3, 0xfc, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xf3, 0xfc, 0x07, 0xfa },
-	{ 0xa9, 0xfa, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x89, 0xfa },
-	{ 0x10, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0xfc },
-	{ 0xd7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xfd },
-	{ 0xdb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfe },
-	{ 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff },
-	{ 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff },
-	{ 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff },
-	{ 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xfe },
-	{ 0x75, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x75, 0xfd },
-	{ 0xcf, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xfb },
-	{ 0x48, 0xfa, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0x48, 0xfa },
-	{ 0x07, 0xfa, 0x6d, 0xfb, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x6d, 0xfb, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x91, 0xfc, 0xdf, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdf, 0xff, 0x71, 0xfc, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xae, 0xfb },
-	{ 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9e, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x9e, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff },
-	{ 0xae, 0xfb, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x91, 0xfc, 0xdb, 0xfe, 0x7d, 0xff },
-	{ 0x9e, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff },
-	{ 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff },
-	{ 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff },
-	{ 0x5d, 0xff, 0xca, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0xca, 0xfa, 0x5d, 0xff },
-	{ 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff },
-	{ 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff },
-	{ 0xbe, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0x9e, 0xff },
-	{ 0x7d, 0xff, 0xdb, 0xfe, 0x91, 0xfc, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x69, 0xfa },
-	{ 0x0b, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb },
-	{ 0x4c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb },
-	{ 0x4c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb },
-	{ 0x2c, 0xfb, 0x27, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x27, 0xfa, 0x2c, 0xfb },
-	{ 0x4c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb },
-	{ 0x4c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb },
-	{ 0x4c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb, 0x0b, 0xfb },
-	{ 0x69, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xdb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xba, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xba, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x14, 0xfd },
-	{ 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd },
-	{ 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd },
-	{ 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd },
-	{ 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd },
-	{ 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd },
-	{ 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd },
-	{ 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd, 0x13, 0xfd },
-	{ 0x92, 0xfc, 0xef, 0xfb, 0x0b, 0xfb, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x0b, 0xfb, 0xef, 0xfb, 0x92, 0xfc },
-	{ 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd },
-	{ 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd },
-	{ 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd },
-	{ 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd },
-	{ 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd },
-	{ 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd },
-	{ 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd, 0x14, 0xfd },
-	{ 0x14, 0xfd, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xba, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x9a, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xdb, 0xfe },
-	{ 0x6d, 0xfb, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x6d, 0xfb },
-	{ 0xdb, 0xfe, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x99, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x38, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0x34, 0xfd, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x34, 0xfd, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x38, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xb6, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x38, 0xfe, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x38, 0xfe, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x96, 0xfd, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xb2, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0xfc },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x30, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x92, 0xfc, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x48, 0xfa },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x48, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x6d, 0xfb, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x6d, 0xfb },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x75, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xd7, 0xfd, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xd7, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x75, 0xfd },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x6d, 0xfb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xdb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x6d, 0xfb },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0xba, 0xfe, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x1c, 0xff, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x1c, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xba, 0xfe, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x27, 0xfa, 0xdf, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x3c, 0xff, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x3c, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xdf, 0xff, 0x27, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x91, 0xfc, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xfb, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0x91, 0xfc, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x59, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x58, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x58, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x59, 0xfe, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x59, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x92, 0xfc, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x92, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xfe },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x27, 0xfa, 0xdb, 0xfe, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfe, 0x27, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x27, 0xfa, 0xf7, 0xfd, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xfd },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x34, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xf7, 0xfd, 0x27, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x75, 0xfd },
-	{ 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0x89, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x89, 0xfa, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff },
-	{ 0x75, 0xfd, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x2c, 0xfb, 0x18, 0xfe, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0x1c, 0xff, 0xa9, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0xaa, 0xfa, 0x1c, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0x18, 0xfe, 0x2c, 0xfb },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x89, 0xfa, 0x38, 0xfe },
-	{ 0x7d, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff },
-	{ 0x38, 0xfe, 0x07, 0xfa, 0x27, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x27, 0xfa, 0x07, 0xfa, 0x38, 0xfe },
-	{ 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x7d, 0xff },
-	{ 0x38, 0xfe, 0x89, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x68, 0xfa, 0x8d, 0xfb, 0x30, 0xfc, 0x54, 0xfd },
-	{ 0x18, 0xfe, 0xba, 0xfe, 0xfb, 0xfe, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0xdb, 0xfe, 0xf7, 0xfd, 0x71, 0xfc, 0x0b, 0xfb },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x0b, 0xfb, 0x71, 0xfc, 0xf7, 0xfd, 0xdb, 0xfe },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff },
-	{ 0x3c, 0xff, 0xfb, 0xfe, 0xba, 0xfe, 0x18, 0xfe },
-	{ 0x54, 0xfd, 0x30, 0xfc, 0x8d, 0xfb, 0x68, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa },
-	{ 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa }
+
+/* 200x150 16-bit (5:6:5 RGB) Phoenix-RTOS logo, compressed */
+static const unsigned char logo16_data[5580] = {
+	0xad, 0x07, 0xfa, 0x07, 0x48, 0xfa, 0x6d, 0xfb, 0x30, 0xfc, 0x34, 0xfd, 0x17, 0xfe, 0x9a, 0xfe,
+	0xdb, 0xfe, 0x1b, 0xff, 0x98, 0x3c, 0xff, 0x04, 0x1c, 0xff, 0xba, 0xfe, 0xf7, 0xfd, 0x51, 0xfc,
+	0x0b, 0xfb, 0x95, 0x07, 0xfa, 0x04, 0x0b, 0xfb, 0x51, 0xfc, 0xf7, 0xfd, 0xba, 0xfe, 0x1c, 0xff,
+	0x98, 0x3c, 0xff, 0x07, 0x1b, 0xff, 0xdb, 0xfe, 0x9a, 0xfe, 0x17, 0xfe, 0x34, 0xfd, 0x30, 0xfc,
+	0x6d, 0xfb, 0x48, 0xfa, 0xad, 0x07, 0xfa, 0xab, 0x07, 0xfa, 0x03, 0x68, 0xfa, 0x18, 0xfe, 0x7d,
+	0xff, 0xbe, 0xff, 0xa2, 0xff, 0xff, 0x03, 0xbe, 0xff, 0x18, 0xfe, 0x07, 0xfa, 0x27, 0xfa, 0x8f,
+	0x07, 0xfa, 0x03, 0x27, 0xfa, 0x07, 0xfa, 0x18, 0xfe, 0xbe, 0xff, 0xa2, 0xff, 0xff, 0x03, 0xbe,
+	0xff, 0x7d, 0xff, 0x18, 0xfe, 0x68, 0xfa, 0xab, 0x07, 0xfa, 0xa9, 0x07, 0xfa, 0x01, 0x2c, 0xfb,
+	0x17, 0xfe, 0xa8, 0xff, 0xff, 0x01, 0xfb, 0xfe, 0x89, 0xfa, 0x8f, 0x07, 0xfa, 0x01, 0xa9, 0xfa,
+	0xfb, 0xfe, 0xa8, 0xff, 0xff, 0x01, 0x17, 0xfe, 0x2c, 0xfb, 0xa9, 0x07, 0xfa, 0xa8, 0x07, 0xfa,
+	0x01, 0x55, 0xfd, 0xbe, 0xff, 0xaa, 0xff, 0xff, 0x01, 0x3c, 0xff, 0x69, 0xfa, 0x8d, 0x07, 0xfa,
+	0x01, 0x89, 0xfa, 0x3c, 0xff, 0xaa, 0xff, 0xff, 0x01, 0xbe, 0xff, 0x55, 0xfd, 0xa8, 0x07, 0xfa,
+	0xa6, 0x07, 0xfa, 0x01, 0x27, 0xfa, 0xd7, 0xfd, 0xad, 0xff, 0xff, 0x00, 0x34, 0xfd, 0x8d, 0x07,
+	0xfa, 0x00, 0x34, 0xfd, 0xad, 0xff, 0xff, 0x01, 0xd7, 0xfd, 0x27, 0xfa, 0xa6, 0x07, 0xfa, 0xa6,
+	0x07, 0xfa, 0x00, 0xdb, 0xfe, 0xae, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x8d, 0x07, 0xfa, 0x00, 0xdf,
+	0xff, 0xae, 0xff, 0xff, 0x00, 0xdb, 0xfe, 0xa6, 0x07, 0xfa, 0xa5, 0x07, 0xfa, 0x00, 0x38, 0xfe,
+	0xb0, 0xff, 0xff, 0x00, 0x92, 0xfc, 0x8b, 0x07, 0xfa, 0x00, 0x92, 0xfc, 0xb0, 0xff, 0xff, 0x00,
+	0x38, 0xfe, 0xa5, 0x07, 0xfa, 0xa4, 0x07, 0xfa, 0x00, 0x38, 0xfe, 0xb1, 0xff, 0xff, 0x00, 0x38,
+	0xfe, 0x8b, 0x07, 0xfa, 0x00, 0x58, 0xfe, 0xb1, 0xff, 0xff, 0x00, 0x38, 0xfe, 0xa4, 0x07, 0xfa,
+	0xa3, 0x07, 0xfa, 0x00, 0x71, 0xfc, 0xb2, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8b, 0x07, 0xfa, 0x00,
+	0xfb, 0xfe, 0xb2, 0xff, 0xff, 0x00, 0x71, 0xfc, 0xa3, 0x07, 0xfa, 0xa3, 0x07, 0xfa, 0x00, 0xdf,
+	0xff, 0xb2, 0xff, 0xff, 0x00, 0x3c, 0xff, 0x8b, 0x07, 0xfa, 0x00, 0x3c, 0xff, 0xb2, 0xff, 0xff,
+	0x00, 0xdf, 0xff, 0xa3, 0x07, 0xfa, 0xa2, 0x07, 0xfa, 0x00, 0x9a, 0xfe, 0xb3, 0xff, 0xff, 0x00,
+	0x1c, 0xff, 0x8b, 0x07, 0xfa, 0x00, 0x1c, 0xff, 0xb3, 0xff, 0xff, 0x00, 0x9a, 0xfe, 0xa2, 0x07,
+	0xfa, 0xa1, 0x07, 0xfa, 0x01, 0x6d, 0xfb, 0xdf, 0xff, 0xb3, 0xff, 0xff, 0x00, 0xdb, 0xfe, 0x8b,
+	0x07, 0xfa, 0x00, 0xdb, 0xfe, 0xb3, 0xff, 0xff, 0x01, 0xdf, 0xff, 0x6d, 0xfb, 0xa1, 0x07, 0xfa,
+	0xa1, 0x07, 0xfa, 0x00, 0x75, 0xfd, 0xb4, 0xff, 0xff, 0x00, 0xd7, 0xfd, 0x8b, 0x07, 0xfa, 0x00,
+	0xd7, 0xfd, 0xb4, 0xff, 0xff, 0x00, 0x75, 0xfd, 0xa1, 0x07, 0xfa, 0xa1, 0x07, 0xfa, 0x00, 0x7d,
+	0xff, 0xb4, 0xff, 0xff, 0x00, 0x6d, 0xfb, 0x8b, 0x07, 0xfa, 0x00, 0x6d, 0xfb, 0xb4, 0xff, 0xff,
+	0x00, 0x7d, 0xff, 0xa1, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0x48, 0xfa, 0xb4, 0xff, 0xff, 0x00,
+	0x3c, 0xff, 0x8d, 0x07, 0xfa, 0x00, 0x3c, 0xff, 0xb4, 0xff, 0xff, 0x00, 0x27, 0xfa, 0xa0, 0x07,
+	0xfa, 0xa0, 0x07, 0xfa, 0x00, 0x92, 0xfc, 0xb4, 0xff, 0xff, 0x00, 0x30, 0xfc, 0x8d, 0x07, 0xfa,
+	0x00, 0x30, 0xfc, 0xb4, 0xff, 0xff, 0x00, 0x92, 0xfc, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00,
+	0x96, 0xfd, 0xb3, 0xff, 0xff, 0x00, 0x38, 0xfe, 0x8f, 0x07, 0xfa, 0x00, 0x38, 0xfe, 0xb3, 0xff,
+	0xff, 0x00, 0x96, 0xfd, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0x38, 0xfe, 0xb2, 0xff, 0xff,
+	0x00, 0x55, 0xfd, 0x91, 0x07, 0xfa, 0x00, 0x55, 0xfd, 0xb2, 0xff, 0xff, 0x00, 0x38, 0xfe, 0xa0,
+	0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0x9a, 0xfe, 0xaf, 0xff, 0xff, 0x02, 0xbe, 0xff, 0xfb, 0xfe,
+	0x8d, 0xfb, 0x93, 0x07, 0xfa, 0x02, 0x8d, 0xfb, 0xfb, 0xfe, 0xbe, 0xff, 0xaf, 0xff, 0xff, 0x00,
+	0x99, 0xfe, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0xba, 0xfe, 0x8f, 0xff, 0xff, 0x01, 0x9e,
+	0xff, 0x55, 0xfd, 0x98, 0x75, 0xfd, 0x03, 0x34, 0xfd, 0xb2, 0xfc, 0xef, 0xfb, 0x2c, 0xfb, 0x97,
+	0x07, 0xfa, 0x03, 0x2c, 0xfb, 0xef, 0xfb, 0xb2, 0xfc, 0x34, 0xfd, 0x98, 0x75, 0xfd, 0x01, 0x55,
+	0xfd, 0x9e, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xba, 0xfe, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00,
+	0xdb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff,
+	0xff, 0x00, 0xba, 0xfe, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff,
+	0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0xa0,
+	0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07,
+	0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa,
+	0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f,
+	0xff, 0xff, 0x00, 0xfb, 0xfe, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff,
+	0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe,
+	0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7,
+	0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0xa0, 0x07, 0xfa, 0x84, 0x07,
+	0xfa, 0x02, 0x68, 0xfa, 0x0b, 0xfb, 0x2c, 0xfb, 0x87, 0x4c, 0xfb, 0x01, 0x2c, 0xfb, 0x27, 0xfa,
+	0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00,
+	0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0x27, 0xfa, 0x2c, 0xfb,
+	0x87, 0x4c, 0xfb, 0x02, 0x2c, 0xfb, 0x0b, 0xfb, 0x68, 0xfa, 0x84, 0x07, 0xfa, 0x82, 0x07, 0xfa,
+	0x03, 0x71, 0xfc, 0xba, 0xfe, 0x7d, 0xff, 0x9e, 0xff, 0x88, 0xbe, 0xff, 0x01, 0x5d, 0xff, 0xca,
+	0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa,
+	0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x5d,
+	0xff, 0x88, 0xbe, 0xff, 0x03, 0x9e, 0xff, 0x7d, 0xff, 0xba, 0xfe, 0x71, 0xfc, 0x82, 0x07, 0xfa,
+	0x80, 0x07, 0xfa, 0x01, 0x8d, 0xfb, 0x1c, 0xff, 0x8c, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa,
+	0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00,
+	0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff,
+	0x8c, 0xff, 0xff, 0x01, 0x1c, 0xff, 0x8d, 0xfb, 0x80, 0x07, 0xfa, 0x03, 0x07, 0xfa, 0x07, 0xfa,
+	0x51, 0xfc, 0xdf, 0xff, 0x8d, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00,
+	0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff,
+	0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x8d, 0xff, 0xff, 0x03,
+	0xdf, 0xff, 0x51, 0xfc, 0x07, 0xfa, 0x07, 0xfa, 0x01, 0x07, 0xfa, 0x4c, 0xfb, 0x8f, 0xff, 0xff,
+	0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d,
+	0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa,
+	0x01, 0xca, 0xfa, 0x9e, 0xff, 0x8f, 0xff, 0xff, 0x01, 0x4c, 0xfb, 0x07, 0xfa, 0x01, 0x48, 0xfa,
+	0x3c, 0xff, 0x8f, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe,
+	0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00,
+	0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x8f, 0xff, 0xff, 0x01, 0x3c, 0xff,
+	0x48, 0xfa, 0x00, 0xce, 0xfb, 0x90, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa,
+	0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f,
+	0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x8f, 0xff, 0xff,
+	0x01, 0xdf, 0xff, 0xce, 0xfb, 0x00, 0x75, 0xfd, 0x90, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa,
+	0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00,
+	0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff,
+	0x90, 0xff, 0xff, 0x00, 0x75, 0xfd, 0x00, 0x9a, 0xfe, 0x90, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xca,
+	0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa,
+	0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e,
+	0xff, 0x90, 0xff, 0xff, 0x00, 0x9a, 0xfe, 0x00, 0x3c, 0xff, 0x90, 0xff, 0xff, 0x01, 0x9e, 0xff,
+	0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07,
+	0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa,
+	0x9e, 0xff, 0x90, 0xff, 0xff, 0x00, 0x3c, 0xff, 0x00, 0x5d, 0xff, 0x90, 0xff, 0xff, 0x01, 0x9e,
+	0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7,
+	0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca,
+	0xfa, 0x9e, 0xff, 0x90, 0xff, 0xff, 0x00, 0x5d, 0xff, 0x00, 0x5d, 0xff, 0x90, 0xff, 0xff, 0x01,
+	0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff,
+	0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01,
+	0xca, 0xfa, 0x9e, 0xff, 0x90, 0xff, 0xff, 0x00, 0x5c, 0xff, 0x00, 0xdb, 0xfe, 0x90, 0xff, 0xff,
+	0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d,
+	0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa,
+	0x01, 0xca, 0xfa, 0x9e, 0xff, 0x90, 0xff, 0xff, 0x00, 0xdb, 0xfe, 0x00, 0xd7, 0xfd, 0x90, 0xff,
+	0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00,
+	0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07,
+	0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x90, 0xff, 0xff, 0x00, 0xd7, 0xfd, 0x00, 0x10, 0xfc, 0x90,
+	0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff,
+	0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a,
+	0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x90, 0xff, 0xff, 0x00, 0x10, 0xfc, 0x01, 0xa9, 0xfa,
+	0x9e, 0xff, 0x8f, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe,
+	0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00,
+	0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x8f, 0xff, 0xff, 0x01, 0x9e, 0xff,
+	0xa9, 0xfa, 0x01, 0x07, 0xfa, 0x14, 0xfd, 0x8f, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a,
+	0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d,
+	0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x8f,
+	0xff, 0xff, 0x01, 0x14, 0xfd, 0x07, 0xfa, 0x02, 0x07, 0xfa, 0x07, 0xfa, 0xb6, 0xfd, 0x8e, 0xff,
+	0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00,
+	0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07,
+	0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x8e, 0xff, 0xff, 0x02, 0xb6, 0xfd, 0x07, 0xfa, 0x07, 0xfa,
+	0x80, 0x07, 0xfa, 0x01, 0xb6, 0xfd, 0xbe, 0xff, 0x8c, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa,
+	0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00,
+	0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff,
+	0x8c, 0xff, 0xff, 0x01, 0xbe, 0xff, 0xb6, 0xfd, 0x80, 0x07, 0xfa, 0x81, 0x07, 0xfa, 0x02, 0x4c,
+	0xfb, 0x96, 0xfd, 0x7d, 0xff, 0x8a, 0xff, 0xff, 0x01, 0xbe, 0xff, 0xea, 0xfa, 0x8a, 0x07, 0xfa,
+	0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f,
+	0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xea, 0xfa, 0xbe, 0xff, 0x8a, 0xff, 0xff,
+	0x02, 0x7d, 0xff, 0x96, 0xfd, 0x4c, 0xfb, 0x81, 0x07, 0xfa, 0x84, 0x07, 0xfa, 0x02, 0x48, 0xfa,
+	0x30, 0xfc, 0xd2, 0xfc, 0x87, 0xd3, 0xfc, 0x01, 0x92, 0xfc, 0x48, 0xfa, 0x8a, 0x07, 0xfa, 0x00,
+	0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff,
+	0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0x48, 0xfa, 0x92, 0xfc, 0x87, 0xd3, 0xfc, 0x02,
+	0xd2, 0xfc, 0x30, 0xfc, 0x48, 0xfa, 0x84, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f,
+	0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb,
+	0xfe, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff,
+	0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0xa0, 0x07, 0xfa, 0xa0,
+	0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d,
+	0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0xfb, 0xfe,
+	0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00,
+	0xfb, 0xfe, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d,
+	0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0xa0, 0x07, 0xfa,
+	0xa0, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00,
+	0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0xfb,
+	0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff,
+	0x00, 0xfb, 0xfe, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0x1c, 0xff, 0x8f, 0xff, 0xff, 0x00,
+	0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xa0, 0x07,
+	0xfa, 0xa0, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa,
+	0x00, 0x3c, 0xff, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xa0, 0x07, 0xfa, 0x9f, 0x07, 0xfa, 0x01,
+	0x68, 0xfa, 0x7d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x1c, 0xff,
+	0x8f, 0xff, 0xff, 0x01, 0x7d, 0xff, 0x48, 0xfa, 0x9f, 0x07, 0xfa, 0x9f, 0x07, 0xfa, 0x01, 0x0b,
+	0xfb, 0x9e, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0xd7, 0x07, 0xfa, 0x00, 0xdb, 0xfe, 0x8f,
+	0xff, 0xff, 0x01, 0x9e, 0xff, 0x0b, 0xfb, 0x9f, 0x07, 0xfa, 0x9f, 0x07, 0xfa, 0x01, 0xae, 0xfb,
+	0xdf, 0xff, 0x8f, 0xff, 0xff, 0x00, 0x79, 0xfe, 0xd7, 0x07, 0xfa, 0x00, 0x38, 0xfe, 0x8f, 0xff,
+	0xff, 0x01, 0xdf, 0xff, 0xae, 0xfb, 0x9f, 0x07, 0xfa, 0x9f, 0x07, 0xfa, 0x00, 0x14, 0xfd, 0x90,
+	0xff, 0xff, 0x00, 0xb6, 0xfd, 0xd7, 0x07, 0xfa, 0x00, 0x54, 0xfd, 0x90, 0xff, 0xff, 0x00, 0x14,
+	0xfd, 0x9f, 0x07, 0xfa, 0x9f, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x90, 0xff, 0xff, 0x00, 0xb2, 0xfc,
+	0xd7, 0x07, 0xfa, 0x00, 0xef, 0xfb, 0x90, 0xff, 0xff, 0x00, 0x5d, 0xff, 0x9f, 0x07, 0xfa, 0x9e,
+	0x07, 0xfa, 0x00, 0x75, 0xfd, 0x91, 0xff, 0xff, 0x00, 0xaa, 0xfa, 0xd8, 0x07, 0xfa, 0x91, 0xff,
+	0xff, 0x00, 0x75, 0xfd, 0x9e, 0x07, 0xfa, 0x9d, 0x07, 0xfa, 0x01, 0x0f, 0xfc, 0xdf, 0xff, 0x90,
+	0xff, 0xff, 0x00, 0xbe, 0xff, 0xd9, 0x07, 0xfa, 0x00, 0x3c, 0xff, 0x90, 0xff, 0xff, 0x01, 0xdf,
+	0xff, 0x0f, 0xfc, 0x9d, 0x07, 0xfa, 0x9c, 0x07, 0xfa, 0x01, 0x95, 0xfd, 0xdf, 0xff, 0x91, 0xff,
+	0xff, 0x00, 0x99, 0xfe, 0xd9, 0x07, 0xfa, 0x00, 0x96, 0xfd, 0x91, 0xff, 0xff, 0x01, 0xdf, 0xff,
+	0x75, 0xfd, 0x9c, 0x07, 0xfa, 0x97, 0x07, 0xfa, 0x04, 0x89, 0xfa, 0x0b, 0xfb, 0xce, 0xfb, 0x34,
+	0xfd, 0x5d, 0xff, 0x93, 0xff, 0xff, 0x00, 0xb2, 0xfc, 0xd9, 0x07, 0xfa, 0x00, 0xce, 0xfb, 0x93,
+	0xff, 0xff, 0x04, 0x5d, 0xff, 0x34, 0xfd, 0xce, 0xfb, 0x0b, 0xfb, 0x69, 0xfa, 0x97, 0x07, 0xfa,
+	0x83, 0x07, 0xfa, 0x02, 0xef, 0xfb, 0xf7, 0xfd, 0xba, 0xfe, 0x8b, 0xfb, 0xfe, 0x05, 0x1c, 0xff,
+	0x3c, 0xff, 0x5d, 0xff, 0x7d, 0xff, 0x9e, 0xff, 0xdf, 0xff, 0x94, 0xff, 0xff, 0x01, 0xbe, 0xff,
+	0x6d, 0xfb, 0xd9, 0x07, 0xfa, 0x01, 0xaa, 0xfa, 0x9e, 0xff, 0x94, 0xff, 0xff, 0x05, 0xdf, 0xff,
+	0x9e, 0xff, 0x7d, 0xff, 0x5d, 0xff, 0x3c, 0xff, 0x1c, 0xff, 0x8b, 0xfb, 0xfe, 0x02, 0xba, 0xfe,
+	0xf7, 0xfd, 0xef, 0xfb, 0x83, 0x07, 0xfa, 0x80, 0x07, 0xfa, 0x02, 0x68, 0xfa, 0xf3, 0xfc, 0x9e,
+	0xff, 0xab, 0xff, 0xff, 0x00, 0x3c, 0xff, 0xdb, 0x07, 0xfa, 0x00, 0x58, 0xfe, 0xab, 0xff, 0xff,
+	0x02, 0x9e, 0xff, 0xf3, 0xfc, 0x68, 0xfa, 0x80, 0x07, 0xfa, 0x03, 0x07, 0xfa, 0x27, 0xfa, 0x89,
+	0xfa, 0x1c, 0xff, 0xad, 0xff, 0xff, 0x00, 0x91, 0xfc, 0xdb, 0x07, 0xfa, 0x00, 0x48, 0xfa, 0xad,
+	0xff, 0xff, 0x03, 0x1c, 0xff, 0x89, 0xfa, 0x27, 0xfa, 0x07, 0xfa, 0x02, 0x07, 0xfa, 0x07, 0xfa,
+	0x1c, 0xff, 0xad, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xdd, 0x07, 0xfa, 0x00, 0x18, 0xfe, 0xad, 0xff,
+	0xff, 0x02, 0x1c, 0xff, 0x07, 0xfa, 0x07, 0xfa, 0x01, 0x07, 0xfa, 0x79, 0xfe, 0xae, 0xff, 0xff,
+	0x00, 0x30, 0xfc, 0xdd, 0x07, 0xfa, 0x01, 0x4c, 0xfb, 0xbe, 0xff, 0xad, 0xff, 0xff, 0x01, 0x79,
+	0xfe, 0x07, 0xfa, 0x01, 0x4c, 0xfb, 0xbe, 0xff, 0xad, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0xdf, 0x07,
+	0xfa, 0x00, 0x18, 0xfe, 0xad, 0xff, 0xff, 0x01, 0xbe, 0xff, 0x4c, 0xfb, 0x00, 0xd2, 0xfc, 0xad,
+	0xff, 0xff, 0x01, 0xdf, 0xff, 0x89, 0xfa, 0xe0, 0x07, 0xfa, 0x00, 0x3c, 0xff, 0xad, 0xff, 0xff,
+	0x00, 0xb2, 0xfc, 0x00, 0x58, 0xfe, 0xad, 0xff, 0xff, 0x00, 0x50, 0xfc, 0xe1, 0x07, 0xfa, 0x01,
+	0x6d, 0xfb, 0xdf, 0xff, 0xac, 0xff, 0xff, 0x00, 0x58, 0xfe, 0x00, 0x1b, 0xff, 0xac, 0xff, 0xff,
+	0x00, 0xb6, 0xfd, 0xe3, 0x07, 0xfa, 0x00, 0xf3, 0xfc, 0xac, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x00,
+	0x5d, 0xff, 0xab, 0xff, 0xff, 0x00, 0x18, 0xfe, 0xe5, 0x07, 0xfa, 0x00, 0xd6, 0xfd, 0xab, 0xff,
+	0xff, 0x00, 0x5d, 0xff, 0x00, 0x5d, 0xff, 0xab, 0xff, 0xff, 0x00, 0xb6, 0xfd, 0xe5, 0x07, 0xfa,
+	0x00, 0xf7, 0xfd, 0xab, 0xff, 0xff, 0x00, 0x5d, 0xff, 0x00, 0x1b, 0xff, 0xac, 0xff, 0xff, 0x00,
+	0xd3, 0xfc, 0xe3, 0x07, 0xfa, 0x00, 0x96, 0xfd, 0xac, 0xff, 0xff, 0x00, 0x1b, 0xff, 0x00, 0x59,
+	0xfe, 0xac, 0xff, 0xff, 0x01, 0xdf, 0xff, 0x6d, 0xfb, 0xe1, 0x07, 0xfa, 0x00, 0x30, 0xfc, 0xad,
+	0xff, 0xff, 0x00, 0x58, 0xfe, 0x00, 0xd2, 0xfc, 0xad, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xe0, 0x07,
+	0xfa, 0x01, 0x69, 0xfa, 0xdf, 0xff, 0xad, 0xff, 0xff, 0x00, 0xd2, 0xfc, 0x01, 0x4c, 0xfb, 0xbe,
+	0xff, 0xad, 0xff, 0xff, 0x00, 0xf7, 0xfd, 0xdf, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0xad, 0xff, 0xff,
+	0x01, 0xbe, 0xff, 0x4c, 0xfb, 0x01, 0x07, 0xfa, 0x79, 0xfe, 0xad, 0xff, 0xff, 0x01, 0xbe, 0xff,
+	0x4c, 0xfb, 0xdd, 0x07, 0xfa, 0x00, 0x30, 0xfc, 0xae, 0xff, 0xff, 0x01, 0x79, 0xfe, 0x07, 0xfa,
+	0x02, 0x07, 0xfa, 0x07, 0xfa, 0x3c, 0xff, 0xad, 0xff, 0xff, 0x00, 0xf7, 0xfd, 0xdd, 0x07, 0xfa,
+	0x00, 0x3c, 0xff, 0xad, 0xff, 0xff, 0x02, 0x3c, 0xff, 0x07, 0xfa, 0x07, 0xfa, 0x03, 0x07, 0xfa,
+	0x27, 0xfa, 0xa9, 0xfa, 0x3c, 0xff, 0xad, 0xff, 0xff, 0x00, 0x48, 0xfa, 0xdb, 0x07, 0xfa, 0x00,
+	0x91, 0xfc, 0xad, 0xff, 0xff, 0x03, 0x3c, 0xff, 0xa9, 0xfa, 0x27, 0xfa, 0x07, 0xfa, 0x80, 0x07,
+	0xfa, 0x02, 0x69, 0xfa, 0xf3, 0xfc, 0xbe, 0xff, 0xab, 0xff, 0xff, 0x00, 0x38, 0xfe, 0xdb, 0x07,
+	0xfa, 0x00, 0x3c, 0xff, 0xab, 0xff, 0xff, 0x02, 0xbe, 0xff, 0xf3, 0xfc, 0x69, 0xfa, 0x80, 0x07,
+	0xfa, 0x83, 0x07, 0xfa, 0x02, 0x10, 0xfc, 0xf7, 0xfd, 0xdb, 0xfe, 0x8c, 0x1c, 0xff, 0x03, 0x3c,
+	0xff, 0x5d, 0xff, 0x7d, 0xff, 0xbe, 0xff, 0x95, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xa9, 0xfa, 0xd9,
+	0x07, 0xfa, 0x01, 0x6d, 0xfb, 0xbe, 0xff, 0x95, 0xff, 0xff, 0x03, 0xbe, 0xff, 0x7d, 0xff, 0x5d,
+	0xff, 0x3c, 0xff, 0x8c, 0x1c, 0xff, 0x02, 0xdb, 0xfe, 0xf7, 0xfd, 0x10, 0xfc, 0x83, 0x07, 0xfa,
+	0x97, 0x07, 0xfa, 0x04, 0x89, 0xfa, 0x2c, 0xfb, 0xce, 0xfb, 0x54, 0xfd, 0x7d, 0xff, 0x93, 0xff,
+	0xff, 0x00, 0xce, 0xfb, 0xd9, 0x07, 0xfa, 0x00, 0xb2, 0xfc, 0x93, 0xff, 0xff, 0x04, 0x7d, 0xff,
+	0x54, 0xfd, 0xce, 0xfb, 0x2c, 0xfb, 0x89, 0xfa, 0x97, 0x07, 0xfa, 0x9c, 0x07, 0xfa, 0x01, 0x96,
+	0xfd, 0xdf, 0xff, 0x91, 0xff, 0xff, 0x00, 0x96, 0xfd, 0xd9, 0x07, 0xfa, 0x00, 0x79, 0xfe, 0x91,
+	0xff, 0xff, 0x01, 0xdf, 0xff, 0x96, 0xfd, 0x9c, 0x07, 0xfa, 0x9d, 0x07, 0xfa, 0x01, 0x10, 0xfc,
+	0xdf, 0xff, 0x90, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xd9, 0x07, 0xfa, 0x00, 0xbe, 0xff, 0x90, 0xff,
+	0xff, 0x01, 0xdf, 0xff, 0x10, 0xfc, 0x9d, 0x07, 0xfa, 0x9e, 0x07, 0xfa, 0x00, 0x96, 0xfd, 0x91,
+	0xff, 0xff, 0xd8, 0x07, 0xfa, 0x00, 0xaa, 0xfa, 0x91, 0xff, 0xff, 0x00, 0x95, 0xfd, 0x9e, 0x07,
+	0xfa, 0x9f, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x90, 0xff, 0xff, 0x00, 0xcf, 0xfb, 0xd7, 0x07, 0xfa,
+	0x00, 0xb2, 0xfc, 0x90, 0xff, 0xff, 0x00, 0x5d, 0xff, 0x9f, 0x07, 0xfa, 0x9f, 0x07, 0xfa, 0x00,
+	0x34, 0xfd, 0x90, 0xff, 0xff, 0x00, 0x54, 0xfd, 0xd7, 0x07, 0xfa, 0x00, 0xb6, 0xfd, 0x90, 0xff,
+	0xff, 0x00, 0x34, 0xfd, 0x9f, 0x07, 0xfa, 0x9f, 0x07, 0xfa, 0x01, 0xae, 0xfb, 0xdf, 0xff, 0x8f,
+	0xff, 0xff, 0x00, 0x18, 0xfe, 0xd7, 0x07, 0xfa, 0x00, 0x79, 0xfe, 0x8f, 0xff, 0xff, 0x01, 0xdf,
+	0xff, 0xae, 0xfb, 0x9f, 0x07, 0xfa, 0x9f, 0x07, 0xfa, 0x01, 0x0b, 0xfb, 0x9e, 0xff, 0x8f, 0xff,
+	0xff, 0x00, 0xda, 0xfe, 0xd7, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x01, 0x9e, 0xff,
+	0x0b, 0xfb, 0x9f, 0x07, 0xfa, 0x9f, 0x07, 0xfa, 0x01, 0x68, 0xfa, 0x7d, 0xff, 0x8f, 0xff, 0xff,
+	0x00, 0x1c, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x3c, 0xff, 0x8f, 0xff, 0xff, 0x01, 0x7d, 0xff, 0x68,
+	0xfa, 0x9f, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0x3c, 0xff,
+	0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xa0, 0x07, 0xfa, 0xa0,
+	0x07, 0xfa, 0x00, 0x1c, 0xff, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d,
+	0xff, 0x8f, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0xfb, 0xfe,
+	0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00,
+	0xfb, 0xfe, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d,
+	0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0xa0, 0x07, 0xfa,
+	0xa0, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00,
+	0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0xfb,
+	0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff,
+	0x00, 0xfb, 0xfe, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00,
+	0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0xa0, 0x07,
+	0xfa, 0xa0, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa,
+	0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00,
+	0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff,
+	0xff, 0x00, 0xfb, 0xfe, 0xa0, 0x07, 0xfa, 0x85, 0x07, 0xfa, 0x00, 0x0f, 0xfc, 0x88, 0x91, 0xfc,
+	0x01, 0x50, 0xfc, 0x48, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d,
+	0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa,
+	0x01, 0x48, 0xfa, 0x50, 0xfc, 0x88, 0x91, 0xfc, 0x00, 0x0f, 0xfc, 0x85, 0x07, 0xfa, 0x81, 0x07,
+	0xfa, 0x02, 0x2c, 0xfb, 0x95, 0xfd, 0x7d, 0xff, 0x8a, 0xff, 0xff, 0x01, 0xbe, 0xff, 0xea, 0xfa,
+	0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00,
+	0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xea, 0xfa, 0xbe, 0xff,
+	0x8a, 0xff, 0xff, 0x02, 0x7d, 0xff, 0x95, 0xfd, 0x2c, 0xfb, 0x81, 0x07, 0xfa, 0x80, 0x07, 0xfa,
+	0x01, 0xb6, 0xfd, 0xbe, 0xff, 0x8c, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa,
+	0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f,
+	0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x8c, 0xff, 0xff,
+	0x01, 0xbe, 0xff, 0xb6, 0xfd, 0x80, 0x07, 0xfa, 0x02, 0x07, 0xfa, 0x07, 0xfa, 0x96, 0xfd, 0x8e,
+	0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff,
+	0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a,
+	0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x8e, 0xff, 0xff, 0x02, 0x96, 0xfd, 0x07, 0xfa, 0x07,
+	0xfa, 0x01, 0x07, 0xfa, 0xf3, 0xfc, 0x8f, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07,
+	0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff,
+	0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x8f, 0xff,
+	0xff, 0x01, 0xf3, 0xfc, 0x07, 0xfa, 0x01, 0xa9, 0xfa, 0x9e, 0xff, 0x8f, 0xff, 0xff, 0x01, 0x9e,
+	0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7,
+	0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca,
+	0xfa, 0x9e, 0xff, 0x8f, 0xff, 0xff, 0x01, 0x9e, 0xff, 0x89, 0xfa, 0x00, 0x10, 0xfc, 0x90, 0xff,
+	0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00,
+	0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07,
+	0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x90, 0xff, 0xff, 0x00, 0x10, 0xfc, 0x00, 0xd7, 0xfd, 0x90,
+	0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff,
+	0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a,
+	0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x90, 0xff, 0xff, 0x00, 0xd6, 0xfd, 0x00, 0xdb, 0xfe,
+	0x90, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff,
+	0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe,
+	0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x90, 0xff, 0xff, 0x00, 0xdb, 0xfe, 0x00, 0x5d,
+	0xff, 0x90, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f,
+	0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb,
+	0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x90, 0xff, 0xff, 0x00, 0x3c, 0xff, 0x00,
+	0x7d, 0xff, 0x90, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe,
+	0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00,
+	0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x90, 0xff, 0xff, 0x00, 0x5d, 0xff,
+	0x00, 0x3c, 0xff, 0x90, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb,
+	0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff,
+	0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x90, 0xff, 0xff, 0x00, 0x3c,
+	0xff, 0x00, 0x9a, 0xfe, 0x90, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00,
+	0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff,
+	0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x90, 0xff, 0xff, 0x00,
+	0x9a, 0xfe, 0x00, 0x75, 0xfd, 0x90, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa,
+	0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f,
+	0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x90, 0xff, 0xff,
+	0x00, 0x75, 0xfd, 0x00, 0xcf, 0xfb, 0x90, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07,
+	0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff,
+	0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x90, 0xff,
+	0xff, 0x00, 0xce, 0xfb, 0x01, 0x48, 0xfa, 0x3c, 0xff, 0x8f, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xca,
+	0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa,
+	0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e,
+	0xff, 0x8f, 0xff, 0xff, 0x01, 0x3c, 0xff, 0x48, 0xfa, 0x01, 0x07, 0xfa, 0x6d, 0xfb, 0x8f, 0xff,
+	0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00,
+	0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07,
+	0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x8f, 0xff, 0xff, 0x01, 0x6d, 0xfb, 0x07, 0xfa, 0x03, 0x07,
+	0xfa, 0x07, 0xfa, 0x91, 0xfc, 0xdf, 0xff, 0x8d, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a,
+	0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d,
+	0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x8d,
+	0xff, 0xff, 0x03, 0xdf, 0xff, 0x71, 0xfc, 0x07, 0xfa, 0x07, 0xfa, 0x80, 0x07, 0xfa, 0x01, 0xae,
+	0xfb, 0x3c, 0xff, 0x8c, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb,
+	0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff,
+	0x00, 0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x9e, 0xff, 0x8c, 0xff, 0xff, 0x01, 0x1c,
+	0xff, 0xae, 0xfb, 0x80, 0x07, 0xfa, 0x82, 0x07, 0xfa, 0x03, 0x91, 0xfc, 0xdb, 0xfe, 0x7d, 0xff,
+	0x9e, 0xff, 0x88, 0xbe, 0xff, 0x01, 0x5d, 0xff, 0xca, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe,
+	0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00,
+	0xfb, 0xfe, 0x8a, 0x07, 0xfa, 0x01, 0xca, 0xfa, 0x5d, 0xff, 0x88, 0xbe, 0xff, 0x03, 0x9e, 0xff,
+	0x7d, 0xff, 0xdb, 0xfe, 0x91, 0xfc, 0x82, 0x07, 0xfa, 0x84, 0x07, 0xfa, 0x01, 0x69, 0xfa, 0x0b,
+	0xfb, 0x88, 0x4c, 0xfb, 0x01, 0x2c, 0xfb, 0x27, 0xfa, 0x8a, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f,
+	0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb,
+	0xfe, 0x8a, 0x07, 0xfa, 0x01, 0x27, 0xfa, 0x2c, 0xfb, 0x88, 0x4c, 0xfb, 0x01, 0x0b, 0xfb, 0x69,
+	0xfa, 0x84, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff,
+	0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0xa0, 0x07, 0xfa, 0xa0,
+	0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d,
+	0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0xfb, 0xfe,
+	0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00,
+	0xfb, 0xfe, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d,
+	0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0xa0, 0x07, 0xfa,
+	0xa0, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00,
+	0x5d, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xfe, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0xdb,
+	0xfe, 0x8f, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xd7, 0x07, 0xfa, 0x00, 0x5d, 0xff, 0x8f, 0xff, 0xff,
+	0x00, 0xba, 0xfe, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0xba, 0xfe, 0x8f, 0xff, 0xff, 0x00,
+	0x9e, 0xff, 0x99, 0x14, 0xfd, 0x03, 0x13, 0xfd, 0x92, 0xfc, 0xef, 0xfb, 0x0b, 0xfb, 0x97, 0x07,
+	0xfa, 0x02, 0x0b, 0xfb, 0xef, 0xfb, 0x92, 0xfc, 0x9a, 0x14, 0xfd, 0x00, 0x9e, 0xff, 0x8f, 0xff,
+	0xff, 0x00, 0xba, 0xfe, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0x9a, 0xfe, 0xaf, 0xff, 0xff,
+	0x02, 0xbe, 0xff, 0xdb, 0xfe, 0x6d, 0xfb, 0x93, 0x07, 0xfa, 0x02, 0x6d, 0xfb, 0xdb, 0xfe, 0xbe,
+	0xff, 0xaf, 0xff, 0xff, 0x00, 0x99, 0xfe, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0x38, 0xfe,
+	0xb2, 0xff, 0xff, 0x00, 0x34, 0xfd, 0x91, 0x07, 0xfa, 0x00, 0x34, 0xfd, 0xb2, 0xff, 0xff, 0x00,
+	0x38, 0xfe, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0xb6, 0xfd, 0xb3, 0xff, 0xff, 0x00, 0x38,
+	0xfe, 0x8f, 0x07, 0xfa, 0x00, 0x38, 0xfe, 0xb3, 0xff, 0xff, 0x00, 0x96, 0xfd, 0xa0, 0x07, 0xfa,
+	0xa0, 0x07, 0xfa, 0x00, 0xb2, 0xfc, 0xb4, 0xff, 0xff, 0x00, 0x30, 0xfc, 0x8d, 0x07, 0xfa, 0x00,
+	0x30, 0xfc, 0xb4, 0xff, 0xff, 0x00, 0x92, 0xfc, 0xa0, 0x07, 0xfa, 0xa0, 0x07, 0xfa, 0x00, 0x48,
+	0xfa, 0xb4, 0xff, 0xff, 0x00, 0x3c, 0xff, 0x8d, 0x07, 0xfa, 0x00, 0x3c, 0xff, 0xb4, 0xff, 0xff,
+	0x00, 0x48, 0xfa, 0xa0, 0x07, 0xfa, 0xa1, 0x07, 0xfa, 0x00, 0x7d, 0xff, 0xb4, 0xff, 0xff, 0x00,
+	0x6d, 0xfb, 0x8b, 0x07, 0xfa, 0x00, 0x6d, 0xfb, 0xb4, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xa1, 0x07,
+	0xfa, 0xa1, 0x07, 0xfa, 0x00, 0x75, 0xfd, 0xb4, 0xff, 0xff, 0x00, 0xd7, 0xfd, 0x8b, 0x07, 0xfa,
+	0x00, 0xd7, 0xfd, 0xb4, 0xff, 0xff, 0x00, 0x75, 0xfd, 0xa1, 0x07, 0xfa, 0xa1, 0x07, 0xfa, 0x01,
+	0x6d, 0xfb, 0xdf, 0xff, 0xb3, 0xff, 0xff, 0x00, 0xdb, 0xfe, 0x8b, 0x07, 0xfa, 0x00, 0xdb, 0xfe,
+	0xb3, 0xff, 0xff, 0x01, 0xdf, 0xff, 0x6d, 0xfb, 0xa1, 0x07, 0xfa, 0xa2, 0x07, 0xfa, 0x00, 0xba,
+	0xfe, 0xb3, 0xff, 0xff, 0x00, 0x1c, 0xff, 0x8b, 0x07, 0xfa, 0x00, 0x1c, 0xff, 0xb3, 0xff, 0xff,
+	0x00, 0xba, 0xfe, 0xa2, 0x07, 0xfa, 0xa2, 0x07, 0xfa, 0x01, 0x27, 0xfa, 0xdf, 0xff, 0xb2, 0xff,
+	0xff, 0x00, 0x3c, 0xff, 0x8b, 0x07, 0xfa, 0x00, 0x3c, 0xff, 0xb2, 0xff, 0xff, 0x01, 0xdf, 0xff,
+	0x27, 0xfa, 0xa2, 0x07, 0xfa, 0xa3, 0x07, 0xfa, 0x00, 0x91, 0xfc, 0xb2, 0xff, 0xff, 0x00, 0xfb,
+	0xfe, 0x8b, 0x07, 0xfa, 0x00, 0xfb, 0xfe, 0xb2, 0xff, 0xff, 0x00, 0x91, 0xfc, 0xa3, 0x07, 0xfa,
+	0xa4, 0x07, 0xfa, 0x00, 0x59, 0xfe, 0xb1, 0xff, 0xff, 0x00, 0x58, 0xfe, 0x8b, 0x07, 0xfa, 0x00,
+	0x58, 0xfe, 0xb1, 0xff, 0xff, 0x00, 0x59, 0xfe, 0xa4, 0x07, 0xfa, 0xa5, 0x07, 0xfa, 0x00, 0x59,
+	0xfe, 0xb0, 0xff, 0xff, 0x00, 0x92, 0xfc, 0x8b, 0x07, 0xfa, 0x00, 0x92, 0xfc, 0xb0, 0xff, 0xff,
+	0x00, 0x59, 0xfe, 0xa5, 0x07, 0xfa, 0xa5, 0x07, 0xfa, 0x01, 0x27, 0xfa, 0xdb, 0xfe, 0xae, 0xff,
+	0xff, 0x00, 0xdf, 0xff, 0x8d, 0x07, 0xfa, 0x00, 0xdf, 0xff, 0xae, 0xff, 0xff, 0x01, 0xdb, 0xfe,
+	0x27, 0xfa, 0xa5, 0x07, 0xfa, 0xa6, 0x07, 0xfa, 0x01, 0x27, 0xfa, 0xf7, 0xfd, 0xad, 0xff, 0xff,
+	0x00, 0x34, 0xfd, 0x8d, 0x07, 0xfa, 0x00, 0x34, 0xfd, 0xad, 0xff, 0xff, 0x01, 0xf7, 0xfd, 0x27,
+	0xfa, 0xa6, 0x07, 0xfa, 0xa8, 0x07, 0xfa, 0x01, 0x75, 0xfd, 0xbe, 0xff, 0xaa, 0xff, 0xff, 0x01,
+	0x3c, 0xff, 0x89, 0xfa, 0x8d, 0x07, 0xfa, 0x01, 0x89, 0xfa, 0x3c, 0xff, 0xaa, 0xff, 0xff, 0x01,
+	0xbe, 0xff, 0x75, 0xfd, 0xa8, 0x07, 0xfa, 0xa9, 0x07, 0xfa, 0x01, 0x2c, 0xfb, 0x18, 0xfe, 0xa8,
+	0xff, 0xff, 0x01, 0x1c, 0xff, 0xa9, 0xfa, 0x8f, 0x07, 0xfa, 0x01, 0xaa, 0xfa, 0x1c, 0xff, 0xa8,
+	0xff, 0xff, 0x01, 0x18, 0xfe, 0x2c, 0xfb, 0xa9, 0x07, 0xfa, 0xab, 0x07, 0xfa, 0x03, 0x89, 0xfa,
+	0x38, 0xfe, 0x7d, 0xff, 0xdf, 0xff, 0xa2, 0xff, 0xff, 0x03, 0xbe, 0xff, 0x38, 0xfe, 0x07, 0xfa,
+	0x27, 0xfa, 0x8f, 0x07, 0xfa, 0x03, 0x27, 0xfa, 0x07, 0xfa, 0x38, 0xfe, 0xbe, 0xff, 0xa2, 0xff,
+	0xff, 0x03, 0xdf, 0xff, 0x7d, 0xff, 0x38, 0xfe, 0x89, 0xfa, 0xab, 0x07, 0xfa, 0xad, 0x07, 0xfa,
+	0x06, 0x68, 0xfa, 0x8d, 0xfb, 0x30, 0xfc, 0x54, 0xfd, 0x18, 0xfe, 0xba, 0xfe, 0xfb, 0xfe, 0x9a,
+	0x3c, 0xff, 0x03, 0xdb, 0xfe, 0xf7, 0xfd, 0x71, 0xfc, 0x0b, 0xfb, 0x95, 0x07, 0xfa, 0x03, 0x0b,
+	0xfb, 0x71, 0xfc, 0xf7, 0xfd, 0xdb, 0xfe, 0x9a, 0x3c, 0xff, 0x06, 0xfb, 0xfe, 0xba, 0xfe, 0x18,
+	0xfe, 0x54, 0xfd, 0x30, 0xfc, 0x8d, 0xfb, 0x68, 0xfa, 0xad, 0x07, 0xfa
+};
+
+
+static const asset_t logo16 = {
+	.width = 200,
+	.height = 150,
+	.depth = 2,
+	.size = sizeof(logo16_data),
+	.crc = 0xf508675c,
+	.data = logo16_data
 };
 
 
@@ -14,15009 +14,502 @@
 #ifndef _LOGO24_H_
 #define _LOGO24_H_
 
+#include "asset.h"
 
-/* 200x150 24-bit (8:8:8 RGB) Phoenix-RTOS logo */
-static const unsigned char logo24[15000][6] = {
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x44, 0x4a, 0xf9, 0x6b, 0x6f, 0xfa },
-	{ 0x83, 0x85, 0xfa, 0xa4, 0xa5, 0xfb },
-	{ 0xbf, 0xc0, 0xfc, 0xd0, 0xd1, 0xfd },
-	{ 0xdb, 0xdb, 0xfd, 0xdf, 0xe0, 0xfd },
-	{ 0xe4, 0xe5, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe1, 0xe2, 0xfd },
-	{ 0xd7, 0xd7, 0xfd, 0xbb, 0xbc, 0xfc },
-	{ 0x88, 0x8a, 0xfa, 0x5d, 0x62, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x5d, 0x62, 0xf9, 0x89, 0x8b, 0xfa },
-	{ 0xbc, 0xbd, 0xfc, 0xd7, 0xd7, 0xfd },
-	{ 0xe1, 0xe2, 0xfd, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe5, 0xfe },
-	{ 0xdf, 0xe0, 0xfd, 0xdb, 0xdb, 0xfd },
-	{ 0xd0, 0xd1, 0xfd, 0xbf, 0xc0, 0xfc },
-	{ 0xa4, 0xa5, 0xfb, 0x83, 0x85, 0xfa },
-	{ 0x6b, 0x6f, 0xfa, 0x44, 0x4a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x46, 0x4c, 0xf9, 0xc2, 0xc3, 0xfc },
-	{ 0xee, 0xee, 0xfe, 0xf7, 0xf7, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xfe },
-	{ 0xc2, 0xc3, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3d, 0x44, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3d, 0x44, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xc2, 0xc3, 0xfc },
-	{ 0xf4, 0xf4, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf7, 0xf7, 0xff, 0xee, 0xee, 0xfe },
-	{ 0xc2, 0xc3, 0xfc, 0x46, 0x4c, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x60, 0x64, 0xf9, 0xbf, 0xc0, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xdf, 0xdf, 0xfd },
-	{ 0x4c, 0x52, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x4e, 0x54, 0xf9 },
-	{ 0xdf, 0xdf, 0xfd, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xbf, 0xc0, 0xfc, 0x60, 0x64, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xa9, 0xaa, 0xfb },
-	{ 0xf6, 0xf7, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xe4, 0xe5, 0xfe, 0x48, 0x4e, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x4a, 0x50, 0xf9, 0xe5, 0xe5, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xf6, 0xf7, 0xff },
-	{ 0xa8, 0xa9, 0xfb, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3d, 0x44, 0xf9 },
-	{ 0xba, 0xbb, 0xfc, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xa3, 0xa4, 0xfb },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xa4, 0xa5, 0xfb, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xba, 0xbb, 0xfc },
-	{ 0x3d, 0x44, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xd8, 0xd9, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xff },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xf9, 0xfa, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xd8, 0xd9, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xc7, 0xc7, 0xfc, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x90, 0x92, 0xfb, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x91, 0x93, 0xfb },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xc7, 0xc7, 0xfc },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xc7, 0xc7, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xc7, 0xc7, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xc7, 0xc8, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xc6, 0xc7, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x8c, 0x8f, 0xfa, 0xfe, 0xfe, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdf, 0xdf, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdf, 0xdf, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfe, 0xfe, 0xff, 0x8c, 0x8f, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xf9, 0xfa, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xe3, 0xe4, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xe3, 0xe4, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xf9, 0xfa, 0xff },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xd2, 0xd3, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xe3, 0xe3, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xe3, 0xe3, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xd2, 0xd3, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x6a, 0x6e, 0xfa, 0xf9, 0xf9, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xd9, 0xd9, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xd9, 0xda, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf8, 0xf8, 0xff, 0x6a, 0x6e, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xac, 0xad, 0xfb, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xb8, 0xb9, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xb8, 0xba, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xab, 0xac, 0xfb },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xeb, 0xec, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x69, 0x6c, 0xfa, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x6b, 0x6f, 0xfa },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xeb, 0xec, 0xfe },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x41, 0x48, 0xf9 },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xe4, 0xe5, 0xfe },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xe5, 0xe5, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x3f, 0x46, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x91, 0x93, 0xfb },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfd, 0xfd, 0xff, 0x83, 0x85, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x84, 0x86, 0xfa, 0xfd, 0xfd, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x90, 0x92, 0xfb, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xb2, 0xb3, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xc6, 0xc7, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xc6, 0xc7, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xb1, 0xb2, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xc5, 0xc6, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xa9, 0xaa, 0xfb },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xa9, 0xaa, 0xfb, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xc4, 0xc4, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xd0, 0xd0, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff },
-	{ 0xf4, 0xf4, 0xfe, 0xdd, 0xdd, 0xfd },
-	{ 0x6e, 0x71, 0xfa, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x6e, 0x71, 0xfa },
-	{ 0xdd, 0xdd, 0xfd, 0xf4, 0xf4, 0xfe },
-	{ 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xcf, 0xd0, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xd5, 0xd5, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf2, 0xf3, 0xfe, 0xa9, 0xab, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xa4, 0xa5, 0xfb },
-	{ 0x93, 0x96, 0xfb, 0x7d, 0x7f, 0xfa },
-	{ 0x60, 0x64, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x60, 0x64, 0xf9 },
-	{ 0x7c, 0x7e, 0xfa, 0x93, 0x96, 0xfb },
-	{ 0xa3, 0xa4, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xaa, 0xac, 0xfb, 0xaa, 0xac, 0xfb },
-	{ 0xa9, 0xab, 0xfb, 0xf2, 0xf3, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xd5, 0xd5, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xd8, 0xd9, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xd6, 0xd7, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x46, 0x4c, 0xf9 },
-	{ 0x5c, 0x60, 0xf9, 0x63, 0x67, 0xfa },
-	{ 0x66, 0x6a, 0xfa, 0x64, 0x68, 0xfa },
-	{ 0x64, 0x68, 0xfa, 0x64, 0x68, 0xfa },
-	{ 0x64, 0x68, 0xfa, 0x64, 0x68, 0xfa },
-	{ 0x64, 0x68, 0xfa, 0x64, 0x68, 0xfa },
-	{ 0x64, 0x68, 0xfa, 0x64, 0x68, 0xfa },
-	{ 0x60, 0x64, 0xf9, 0x3d, 0x44, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3d, 0x44, 0xf9, 0x60, 0x64, 0xf9 },
-	{ 0x64, 0x68, 0xfa, 0x64, 0x68, 0xfa },
-	{ 0x64, 0x68, 0xfa, 0x64, 0x68, 0xfa },
-	{ 0x64, 0x68, 0xfa, 0x64, 0x68, 0xfa },
-	{ 0x64, 0x68, 0xfa, 0x64, 0x68, 0xfa },
-	{ 0x64, 0x68, 0xfa, 0x66, 0x6a, 0xfa },
-	{ 0x63, 0x67, 0xfa, 0x5c, 0x60, 0xf9 },
-	{ 0x46, 0x4c, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x8b, 0x8d, 0xfa },
-	{ 0xd6, 0xd7, 0xfd, 0xed, 0xed, 0xfe },
-	{ 0xf2, 0xf3, 0xfe, 0xf5, 0xf5, 0xfe },
-	{ 0xf6, 0xf6, 0xfe, 0xf6, 0xf6, 0xfe },
-	{ 0xf6, 0xf6, 0xfe, 0xf6, 0xf6, 0xfe },
-	{ 0xf6, 0xf6, 0xfe, 0xf6, 0xf6, 0xfe },
-	{ 0xf6, 0xf6, 0xfe, 0xf6, 0xf6, 0xfe },
-	{ 0xf6, 0xf6, 0xfe, 0xf6, 0xf6, 0xfe },
-	{ 0xe8, 0xe8, 0xfe, 0x53, 0x59, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x53, 0x59, 0xf9, 0xe8, 0xe8, 0xfe },
-	{ 0xf6, 0xf6, 0xfe, 0xf6, 0xf6, 0xfe },
-	{ 0xf6, 0xf6, 0xfe, 0xf6, 0xf6, 0xfe },
-	{ 0xf6, 0xf6, 0xfe, 0xf6, 0xf6, 0xfe },
-	{ 0xf6, 0xf6, 0xfe, 0xf6, 0xf6, 0xfe },
-	{ 0xf6, 0xf6, 0xfe, 0xf6, 0xf6, 0xfe },
-	{ 0xf5, 0xf5, 0xfe, 0xf2, 0xf3, 0xfe },
-	{ 0xed, 0xed, 0xfe, 0xd6, 0xd7, 0xfd },
-	{ 0x8a, 0x8c, 0xfa, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x6f, 0x72, 0xfa },
-	{ 0xe0, 0xe1, 0xfd, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xe0, 0xe1, 0xfd },
-	{ 0x6f, 0x72, 0xfa, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x89, 0x8b, 0xfa, 0xf9, 0xfa, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf9, 0xfa, 0xff, 0x89, 0x8b, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x66, 0x6a, 0xfa },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x66, 0x6a, 0xfa, 0x3a, 0x42, 0xf9 },
-	{ 0x41, 0x48, 0xf9, 0xe5, 0xe6, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xe5, 0xe6, 0xfe, 0x41, 0x48, 0xf9 },
-	{ 0x77, 0x7a, 0xfa, 0xfc, 0xfc, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfb, 0xff, 0x77, 0x7a, 0xfa },
-	{ 0xac, 0xad, 0xfb, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xab, 0xac, 0xfb },
-	{ 0xd2, 0xd3, 0xfd, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xd1, 0xd2, 0xfd },
-	{ 0xe5, 0xe5, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xe5, 0xe5, 0xfe },
-	{ 0xeb, 0xeb, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xe9, 0xe9, 0xfe },
-	{ 0xe8, 0xe8, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xe7, 0xe8, 0xfe },
-	{ 0xd9, 0xd9, 0xfd, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xd8, 0xd9, 0xfd },
-	{ 0xb8, 0xba, 0xfc, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xb8, 0xba, 0xfc },
-	{ 0x81, 0x83, 0xfa, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0x81, 0x83, 0xfa },
-	{ 0x4e, 0x54, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x4e, 0x54, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xa0, 0xa1, 0xfb },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xa0, 0xa1, 0xfb, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xb2, 0xb4, 0xfc, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xb2, 0xb4, 0xfc },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xb6, 0xb7, 0xfc },
-	{ 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xff },
-	{ 0xb6, 0xb7, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x64, 0x68, 0xfa, 0xb2, 0xb3, 0xfc },
-	{ 0xee, 0xef, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf5, 0xf5, 0xfe, 0x57, 0x5c, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x57, 0x5c, 0xf9, 0xf5, 0xf5, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xee, 0xef, 0xfe },
-	{ 0xb2, 0xb3, 0xfc, 0x64, 0x68, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x44, 0x4a, 0xf9 },
-	{ 0x82, 0x84, 0xfa, 0x96, 0x98, 0xfb },
-	{ 0x98, 0x9a, 0xfb, 0x98, 0x9a, 0xfb },
-	{ 0x98, 0x9a, 0xfb, 0x98, 0x9a, 0xfb },
-	{ 0x98, 0x9a, 0xfb, 0x98, 0x9a, 0xfb },
-	{ 0x98, 0x9a, 0xfb, 0x98, 0x9a, 0xfb },
-	{ 0x98, 0x9a, 0xfb, 0x98, 0x9a, 0xfb },
-	{ 0x90, 0x92, 0xfb, 0x44, 0x4a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x44, 0x4a, 0xf9, 0x90, 0x92, 0xfb },
-	{ 0x98, 0x9a, 0xfb, 0x98, 0x9a, 0xfb },
-	{ 0x98, 0x9a, 0xfb, 0x98, 0x9a, 0xfb },
-	{ 0x98, 0x9a, 0xfb, 0x98, 0x9a, 0xfb },
-	{ 0x98, 0x9a, 0xfb, 0x98, 0x9a, 0xfb },
-	{ 0x98, 0x9a, 0xfb, 0x98, 0x9a, 0xfb },
-	{ 0x96, 0x98, 0xfb, 0x82, 0x84, 0xfa },
-	{ 0x41, 0x48, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xe0, 0xe0, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xe0, 0xe0, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xe8, 0xe9, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xe8, 0xe9, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xe7, 0xe7, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xe8, 0xe9, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x46, 0x4c, 0xf9, 0xed, 0xed, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xe4, 0xe4, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xe2, 0xe2, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xed, 0xed, 0xfe, 0x44, 0x4a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x5d, 0x62, 0xf9, 0xf3, 0xf3, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdd, 0xde, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xd8, 0xd8, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf3, 0xf3, 0xfe, 0x5d, 0x62, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x74, 0x77, 0xfa, 0xfb, 0xfb, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xcd, 0xce, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xc3, 0xc4, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfb, 0xff, 0x74, 0x77, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xa1, 0xa2, 0xfb, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xb6, 0xb7, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xa7, 0xa9, 0xfb },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xa1, 0xa2, 0xfb },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xea, 0xea, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x93, 0x96, 0xfb, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x79, 0x7c, 0xfa },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xe9, 0xe9, 0xfe },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xad, 0xae, 0xfb },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x50, 0x55, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xad, 0xae, 0xfb, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x7f, 0x81, 0xfa, 0xf9, 0xf9, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xff },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xe3, 0xe4, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf9, 0xf9, 0xff, 0x7f, 0x81, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xae, 0xb0, 0xfb },
-	{ 0xf9, 0xfa, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xcf, 0xd0, 0xfd },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xb1, 0xb2, 0xfc, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xf9, 0xfa, 0xff },
-	{ 0xae, 0xaf, 0xfb, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x4a, 0x50, 0xf9, 0x5f, 0x63, 0xf9 },
-	{ 0x75, 0x78, 0xfa, 0xa4, 0xa6, 0xfb },
-	{ 0xeb, 0xeb, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0x93, 0x96, 0xfb },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x77, 0x7a, 0xfa, 0xfd, 0xfd, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xeb, 0xeb, 0xfe },
-	{ 0xa4, 0xa5, 0xfb, 0x75, 0x78, 0xfa },
-	{ 0x5f, 0x63, 0xf9, 0x48, 0x4e, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x7a, 0x7d, 0xfa, 0xbb, 0xbc, 0xfc },
-	{ 0xd6, 0xd7, 0xfd, 0xdd, 0xdd, 0xfd },
-	{ 0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xfd },
-	{ 0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xfd },
-	{ 0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xfd },
-	{ 0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xfd },
-	{ 0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xfd },
-	{ 0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xfd },
-	{ 0xdd, 0xdd, 0xfd, 0xe0, 0xe1, 0xfd },
-	{ 0xe4, 0xe4, 0xfe, 0xea, 0xea, 0xfe },
-	{ 0xee, 0xee, 0xfe, 0xf3, 0xf3, 0xfe },
-	{ 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf7, 0xf7, 0xff, 0x69, 0x6c, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x50, 0x55, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xff },
-	{ 0xf3, 0xf3, 0xfe, 0xee, 0xee, 0xfe },
-	{ 0xea, 0xea, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe0, 0xe1, 0xfd, 0xdd, 0xdd, 0xfd },
-	{ 0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xfd },
-	{ 0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xfd },
-	{ 0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xfd },
-	{ 0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xfd },
-	{ 0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xfd },
-	{ 0xdd, 0xdd, 0xfd, 0xdd, 0xdd, 0xfd },
-	{ 0xdd, 0xdd, 0xfd, 0xd6, 0xd6, 0xfd },
-	{ 0xbb, 0xbc, 0xfc, 0x7a, 0x7d, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x46, 0x4c, 0xf9 },
-	{ 0x9a, 0x9c, 0xfb, 0xf2, 0xf2, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xe3, 0xe4, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xc7, 0xc8, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf2, 0xf2, 0xfe, 0x9a, 0x9c, 0xfb },
-	{ 0x46, 0x4c, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3d, 0x44, 0xf9 },
-	{ 0x4c, 0x52, 0xf9, 0xe3, 0xe3, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x8f, 0x91, 0xfa, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x44, 0x4a, 0xf9 },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xe3, 0xe3, 0xfe, 0x4c, 0x52, 0xf9 },
-	{ 0x3d, 0x44, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xe2, 0xe2, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xe8, 0xe8, 0xfe },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xc0, 0xc1, 0xfc, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xe2, 0xe2, 0xfe },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xcc, 0xcc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfd, 0xfd, 0xff, 0x85, 0x87, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x66, 0x6a, 0xfa, 0xf7, 0xf7, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xcb, 0xcc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x66, 0x6a, 0xfa, 0xf6, 0xf7, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xde, 0xde, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xc0, 0xc1, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf6, 0xf7, 0xff, 0x66, 0x6a, 0xfa },
-	{ 0x96, 0x98, 0xfb, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xff },
-	{ 0x4a, 0x50, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xe5, 0xe5, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0x95, 0x97, 0xfb },
-	{ 0xc7, 0xc8, 0xfc, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfe, 0xfe, 0xff, 0x86, 0x88, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x6b, 0x6f, 0xfa, 0xf9, 0xf9, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xc7, 0xc8, 0xfc },
-	{ 0xdf, 0xe0, 0xfd, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xb3, 0xb4, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x9d, 0x9e, 0xfb },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xdf, 0xdf, 0xfd },
-	{ 0xea, 0xea, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xc0, 0xc1, 0xfc },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xb6, 0xb8, 0xfc, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xe9, 0xe9, 0xfe },
-	{ 0xea, 0xea, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xb4, 0xb5, 0xfc },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xbe, 0xbf, 0xfc, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xe9, 0xe9, 0xfe },
-	{ 0xdf, 0xe0, 0xfd, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x99, 0x9b, 0xfb, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xb1, 0xb2, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xdf, 0xe0, 0xfd },
-	{ 0xc8, 0xc9, 0xfc, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf9, 0xf9, 0xff, 0x69, 0x6c, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x84, 0x86, 0xfa, 0xfd, 0xfd, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xc7, 0xc8, 0xfc },
-	{ 0x96, 0x98, 0xfb, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xe2, 0xe3, 0xfe },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x48, 0x4e, 0xf9 },
-	{ 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0x96, 0x98, 0xfb },
-	{ 0x66, 0x6a, 0xfa, 0xf7, 0xf7, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xbe, 0xbf, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdd, 0xdd, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf7, 0xf7, 0xff, 0x66, 0x6a, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0xcd, 0xce, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf7, 0xf7, 0xff, 0x64, 0x68, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x85, 0x87, 0xfa, 0xfd, 0xfd, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xcd, 0xce, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xe4, 0xe5, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xbc, 0xbd, 0xfc },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xe6, 0xe6, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xe4, 0xe4, 0xfe },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3d, 0x44, 0xf9 },
-	{ 0x4e, 0x54, 0xf9, 0xe4, 0xe5, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x41, 0x48, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x8d, 0x90, 0xfa },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xe4, 0xe4, 0xfe, 0x4e, 0x54, 0xf9 },
-	{ 0x3d, 0x44, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x48, 0x4e, 0xf9 },
-	{ 0x9d, 0x9f, 0xfb, 0xf4, 0xf4, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xc5, 0xc6, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xe3, 0xe4, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf4, 0xf4, 0xfe, 0x9d, 0x9f, 0xfb },
-	{ 0x48, 0x4e, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x81, 0x83, 0xfa, 0xbe, 0xbf, 0xfc },
-	{ 0xd8, 0xd9, 0xfd, 0xe1, 0xe1, 0xfd },
-	{ 0xe1, 0xe2, 0xfd, 0xe1, 0xe2, 0xfd },
-	{ 0xe1, 0xe2, 0xfd, 0xe1, 0xe2, 0xfd },
-	{ 0xe1, 0xe2, 0xfd, 0xe1, 0xe2, 0xfd },
-	{ 0xe1, 0xe2, 0xfd, 0xe1, 0xe2, 0xfd },
-	{ 0xe1, 0xe2, 0xfd, 0xe1, 0xe2, 0xfd },
-	{ 0xe1, 0xe2, 0xfd, 0xe1, 0xe2, 0xfd },
-	{ 0xe1, 0xe2, 0xfd, 0xe1, 0xe2, 0xfd },
-	{ 0xe7, 0xe7, 0xfe, 0xea, 0xea, 0xfe },
-	{ 0xee, 0xef, 0xfe, 0xf4, 0xf4, 0xfe },
-	{ 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf0, 0xf0, 0xfe, 0x4e, 0x54, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x69, 0x6c, 0xfa, 0xf7, 0xf7, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xff },
-	{ 0xf4, 0xf4, 0xfe, 0xee, 0xef, 0xfe },
-	{ 0xea, 0xea, 0xfe, 0xe7, 0xe7, 0xfe },
-	{ 0xe1, 0xe2, 0xfd, 0xe1, 0xe2, 0xfd },
-	{ 0xe1, 0xe2, 0xfd, 0xe1, 0xe2, 0xfd },
-	{ 0xe1, 0xe2, 0xfd, 0xe1, 0xe2, 0xfd },
-	{ 0xe1, 0xe2, 0xfd, 0xe1, 0xe2, 0xfd },
-	{ 0xe1, 0xe2, 0xfd, 0xe1, 0xe2, 0xfd },
-	{ 0xe1, 0xe2, 0xfd, 0xe1, 0xe2, 0xfd },
-	{ 0xe1, 0xe2, 0xfd, 0xe1, 0xe2, 0xfd },
-	{ 0xe1, 0xe1, 0xfd, 0xd8, 0xd9, 0xfd },
-	{ 0xbe, 0xbf, 0xfc, 0x81, 0x83, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x4c, 0x52, 0xf9, 0x60, 0x64, 0xf9 },
-	{ 0x76, 0x79, 0xfa, 0xa7, 0xa9, 0xfb },
-	{ 0xed, 0xed, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfd, 0xfd, 0xff, 0x77, 0x7a, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x93, 0x96, 0xfb, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xed, 0xed, 0xfe },
-	{ 0xa7, 0xa8, 0xfb, 0x76, 0x79, 0xfa },
-	{ 0x60, 0x64, 0xf9, 0x4c, 0x52, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xb2, 0xb3, 0xfc },
-	{ 0xf9, 0xfa, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xb0, 0xb1, 0xfb },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xcf, 0xcf, 0xfd, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xf9, 0xfa, 0xff },
-	{ 0xb1, 0xb2, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x81, 0x83, 0xfa, 0xf9, 0xfa, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xe2, 0xe2, 0xfe },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf9, 0xfa, 0xff, 0x80, 0x82, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xb0, 0xb1, 0xfb },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x50, 0x55, 0xf9 },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xaf, 0xb0, 0xfb, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xeb, 0xeb, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x78, 0x7b, 0xfa, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x93, 0x96, 0xfb },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xea, 0xea, 0xfe },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xa3, 0xa4, 0xfb, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xa7, 0xa8, 0xfb, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xb6, 0xb7, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xa2, 0xa4, 0xfb },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x74, 0x77, 0xfa, 0xfb, 0xfb, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xc2, 0xc3, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xcd, 0xce, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfb, 0xfb, 0xff, 0x74, 0x77, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x5d, 0x62, 0xf9, 0xf3, 0xf3, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xd7, 0xd8, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdd, 0xde, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf3, 0xf3, 0xfe, 0x5d, 0x62, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x46, 0x4c, 0xf9, 0xed, 0xed, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xe1, 0xe2, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xe4, 0xe4, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xed, 0xed, 0xfe, 0x46, 0x4c, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xe8, 0xe9, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xe6, 0xe7, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xe8, 0xe9, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xe8, 0xe9, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xe0, 0xe1, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xe0, 0xe0, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x7e, 0x80, 0xfa, 0x8e, 0x90, 0xfa },
-	{ 0x8e, 0x90, 0xfa, 0x8e, 0x90, 0xfa },
-	{ 0x8e, 0x90, 0xfa, 0x8e, 0x90, 0xfa },
-	{ 0x8e, 0x90, 0xfa, 0x8e, 0x90, 0xfa },
-	{ 0x8e, 0x90, 0xfa, 0x8e, 0x90, 0xfa },
-	{ 0x8e, 0x90, 0xfa, 0x8e, 0x90, 0xfa },
-	{ 0x87, 0x89, 0xfa, 0x41, 0x48, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x41, 0x48, 0xf9, 0x87, 0x89, 0xfa },
-	{ 0x8e, 0x90, 0xfa, 0x8e, 0x90, 0xfa },
-	{ 0x8e, 0x90, 0xfa, 0x8e, 0x90, 0xfa },
-	{ 0x8e, 0x90, 0xfa, 0x8e, 0x90, 0xfa },
-	{ 0x8e, 0x90, 0xfa, 0x8e, 0x90, 0xfa },
-	{ 0x8e, 0x90, 0xfa, 0x8e, 0x90, 0xfa },
-	{ 0x8e, 0x90, 0xfa, 0x7e, 0x80, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x63, 0x67, 0xfa, 0xaf, 0xb0, 0xfb },
-	{ 0xec, 0xed, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf6, 0xf6, 0xfe, 0x57, 0x5c, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x57, 0x5c, 0xf9, 0xf6, 0xf6, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xec, 0xec, 0xfe },
-	{ 0xaf, 0xb0, 0xfb, 0x63, 0x67, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xb3, 0xb4, 0xfc },
-	{ 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xff },
-	{ 0xb2, 0xb4, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xb0, 0xb1, 0xfb, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xb0, 0xb1, 0xfb },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x9d, 0x9e, 0xfb },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x9d, 0x9e, 0xfb, 0x3a, 0x42, 0xf9 },
-	{ 0x4e, 0x54, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x4c, 0x52, 0xf9 },
-	{ 0x80, 0x82, 0xfa, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0x80, 0x82, 0xfa },
-	{ 0xb8, 0xb9, 0xfc, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xb7, 0xb8, 0xfc },
-	{ 0xd8, 0xd9, 0xfd, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xd8, 0xd9, 0xfd },
-	{ 0xe8, 0xe8, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xfe },
-	{ 0xeb, 0xec, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xe9, 0xe9, 0xfe },
-	{ 0xe5, 0xe5, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xe5, 0xe5, 0xfe },
-	{ 0xd2, 0xd3, 0xfd, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xd2, 0xd3, 0xfd },
-	{ 0xac, 0xae, 0xfb, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xac, 0xad, 0xfb },
-	{ 0x78, 0x7b, 0xfa, 0xfc, 0xfc, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfc, 0xfc, 0xff, 0x77, 0x7a, 0xfa },
-	{ 0x41, 0x48, 0xf9, 0xe6, 0xe6, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xe6, 0xe6, 0xfe, 0x41, 0x48, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x69, 0x6c, 0xfa },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x69, 0x6c, 0xfa, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x8d, 0x90, 0xfa, 0xfa, 0xfa, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfa, 0xfa, 0xff, 0x8c, 0x8f, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x70, 0x74, 0xfa },
-	{ 0xe3, 0xe4, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xe3, 0xe3, 0xfe },
-	{ 0x70, 0x74, 0xfa, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x8f, 0x91, 0xfa },
-	{ 0xd9, 0xd9, 0xfd, 0xee, 0xee, 0xfe },
-	{ 0xf3, 0xf3, 0xfe, 0xf5, 0xf5, 0xfe },
-	{ 0xf6, 0xf6, 0xfe, 0xf6, 0xf6, 0xfe },
-	{ 0xf6, 0xf6, 0xfe, 0xf6, 0xf6, 0xfe },
-	{ 0xf6, 0xf6, 0xfe, 0xf6, 0xf6, 0xfe },
-	{ 0xf6, 0xf6, 0xfe, 0xf6, 0xf6, 0xfe },
-	{ 0xf6, 0xf6, 0xfe, 0xf6, 0xf6, 0xfe },
-	{ 0xe8, 0xe8, 0xfe, 0x53, 0x59, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x53, 0x59, 0xf9, 0xe8, 0xe8, 0xfe },
-	{ 0xf6, 0xf6, 0xfe, 0xf6, 0xf6, 0xfe },
-	{ 0xf6, 0xf6, 0xfe, 0xf6, 0xf6, 0xfe },
-	{ 0xf6, 0xf6, 0xfe, 0xf6, 0xf6, 0xfe },
-	{ 0xf6, 0xf6, 0xfe, 0xf6, 0xf6, 0xfe },
-	{ 0xf6, 0xf6, 0xfe, 0xf6, 0xf6, 0xfe },
-	{ 0xf5, 0xf5, 0xfe, 0xf3, 0xf3, 0xfe },
-	{ 0xed, 0xee, 0xfe, 0xd9, 0xd9, 0xfd },
-	{ 0x8e, 0x90, 0xfa, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x48, 0x4e, 0xf9 },
-	{ 0x5d, 0x62, 0xf9, 0x64, 0x68, 0xfa },
-	{ 0x64, 0x68, 0xfa, 0x64, 0x68, 0xfa },
-	{ 0x64, 0x68, 0xfa, 0x64, 0x68, 0xfa },
-	{ 0x64, 0x68, 0xfa, 0x64, 0x68, 0xfa },
-	{ 0x64, 0x68, 0xfa, 0x64, 0x68, 0xfa },
-	{ 0x64, 0x68, 0xfa, 0x64, 0x68, 0xfa },
-	{ 0x60, 0x64, 0xf9, 0x3d, 0x44, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3d, 0x44, 0xf9, 0x60, 0x64, 0xf9 },
-	{ 0x64, 0x68, 0xfa, 0x64, 0x68, 0xfa },
-	{ 0x64, 0x68, 0xfa, 0x64, 0x68, 0xfa },
-	{ 0x64, 0x68, 0xfa, 0x64, 0x68, 0xfa },
-	{ 0x64, 0x68, 0xfa, 0x64, 0x68, 0xfa },
-	{ 0x64, 0x68, 0xfa, 0x64, 0x68, 0xfa },
-	{ 0x64, 0x68, 0xfa, 0x5d, 0x62, 0xf9 },
-	{ 0x48, 0x4e, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdb, 0xdc, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdb, 0xdc, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xd9, 0xd9, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xea, 0xea, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xea, 0xea, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xd6, 0xd7, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xd5, 0xd5, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf1, 0xf2, 0xfe, 0xa1, 0xa2, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0x9f, 0xa1, 0xfb },
-	{ 0x90, 0x92, 0xfb, 0x79, 0x7c, 0xfa },
-	{ 0x5f, 0x63, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x5f, 0x63, 0xf9 },
-	{ 0x7a, 0x7d, 0xfa, 0x91, 0x93, 0xfb },
-	{ 0xa0, 0xa1, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa3, 0xfb, 0xa1, 0xa3, 0xfb },
-	{ 0xa1, 0xa2, 0xfb, 0xf1, 0xf2, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xd5, 0xd5, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xd0, 0xd1, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff },
-	{ 0xf4, 0xf4, 0xfe, 0xda, 0xdb, 0xfd },
-	{ 0x69, 0x6c, 0xfa, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x6a, 0x6e, 0xfa },
-	{ 0xdb, 0xdb, 0xfd, 0xf4, 0xf4, 0xfe },
-	{ 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xcf, 0xd0, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xc5, 0xc6, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xa6, 0xa7, 0xfb },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xa6, 0xa7, 0xfb, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xc4, 0xc5, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xb2, 0xb4, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xc4, 0xc5, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xc5, 0xc6, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xb2, 0xb3, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x92, 0x94, 0xfb },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfd, 0xfd, 0xff, 0x82, 0x84, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x83, 0x85, 0xfa, 0xfd, 0xfd, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x91, 0x93, 0xfb, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x41, 0x48, 0xf9 },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xe3, 0xe4, 0xfe },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xe4, 0xe4, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x41, 0x48, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xec, 0xed, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x69, 0x6c, 0xfa, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x69, 0x6c, 0xfa },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xec, 0xed, 0xfe },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xad, 0xae, 0xfb, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xb8, 0xb9, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xb8, 0xb9, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xad, 0xae, 0xfb },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x6a, 0x6e, 0xfa, 0xf9, 0xf9, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xd9, 0xd9, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xd9, 0xd9, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf9, 0xf9, 0xff, 0x6a, 0x6e, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xd4, 0xd5, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xe3, 0xe3, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xe3, 0xe3, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xd4, 0xd5, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3d, 0x44, 0xf9 },
-	{ 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xe3, 0xe4, 0xfe, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xe3, 0xe4, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xff },
-	{ 0x3d, 0x44, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x8e, 0x90, 0xfa, 0xfe, 0xfe, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xdf, 0xdf, 0xfd, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xdf, 0xdf, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xfe, 0xfe, 0xff, 0x8d, 0x90, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xc9, 0xca, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xc7, 0xc8, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xc7, 0xc8, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xc8, 0xc9, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xc8, 0xc9, 0xfc, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0x91, 0x93, 0xfb, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x91, 0x93, 0xfb },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xc8, 0xc9, 0xfc },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3f, 0x46, 0xf9, 0xdb, 0xdb, 0xfd },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xf9, 0xfa, 0xff },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xda, 0xdb, 0xfd, 0x3f, 0x46, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3f, 0x46, 0xf9 },
-	{ 0xbd, 0xbe, 0xfc, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xa5, 0xa7, 0xfb },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0xa6, 0xa7, 0xfb, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xbd, 0xbe, 0xfc },
-	{ 0x3d, 0x44, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xac, 0xae, 0xfb },
-	{ 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xe5, 0xe6, 0xfe, 0x4a, 0x50, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x4a, 0x50, 0xf9, 0xe6, 0xe6, 0xfe },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xff },
-	{ 0xac, 0xad, 0xfb, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x62, 0x66, 0xfa, 0xc2, 0xc3, 0xfc },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xe1, 0xe2, 0xfd },
-	{ 0x4e, 0x54, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x50, 0x55, 0xf9 },
-	{ 0xe1, 0xe2, 0xfd, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xc2, 0xc3, 0xfc, 0x62, 0x66, 0xfa },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x4a, 0x50, 0xf9, 0xc5, 0xc6, 0xfc },
-	{ 0xee, 0xef, 0xfe, 0xf8, 0xf8, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xfe },
-	{ 0xc5, 0xc6, 0xfc, 0x3a, 0x42, 0xf9 },
-	{ 0x3d, 0x44, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3d, 0x44, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0xc5, 0xc6, 0xfc },
-	{ 0xf5, 0xf5, 0xfe, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
-	{ 0xf8, 0xf8, 0xff, 0xee, 0xef, 0xfe },
-	{ 0xc5, 0xc6, 0xfc, 0x4a, 0x50, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x46, 0x4c, 0xf9, 0x6c, 0x70, 0xfa },
-	{ 0x84, 0x86, 0xfa, 0xa7, 0xa9, 0xfb },
-	{ 0xc2, 0xc3, 0xfc, 0xd3, 0xd4, 0xfd },
-	{ 0xdd, 0xdd, 0xfd, 0xe3, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe3, 0xe4, 0xfe },
-	{ 0xd9, 0xd9, 0xfd, 0xbe, 0xbf, 0xfc },
-	{ 0x8b, 0x8e, 0xfa, 0x5f, 0x63, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x5f, 0x63, 0xf9, 0x8b, 0x8e, 0xfa },
-	{ 0xbe, 0xbf, 0xfc, 0xd9, 0xd9, 0xfd },
-	{ 0xe3, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe4, 0xe4, 0xfe, 0xe4, 0xe4, 0xfe },
-	{ 0xe3, 0xe4, 0xfe, 0xdd, 0xdd, 0xfd },
-	{ 0xd3, 0xd4, 0xfd, 0xc2, 0xc3, 0xfc },
-	{ 0xa7, 0xa9, 0xfb, 0x84, 0x86, 0xfa },
-	{ 0x6c, 0x70, 0xfa, 0x46, 0x4c, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 },
-	{ 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9 }
+
+/* 200x150 24-bit (8:8:8 RGB) Phoenix-RTOS logo, compressed */
+static const unsigned char logo24_data[7686] = {
+	0xad, 0x3a, 0x42, 0xf9, 0x08, 0x44, 0x4a, 0xf9, 0x6b, 0x6f, 0xfa, 0x83, 0x85, 0xfa, 0xa4, 0xa5,
+	0xfb, 0xbf, 0xc0, 0xfc, 0xd0, 0xd1, 0xfd, 0xdb, 0xdb, 0xfd, 0xdf, 0xe0, 0xfd, 0xe4, 0xe5, 0xfe,
+	0x97, 0xe4, 0xe4, 0xfe, 0x04, 0xe1, 0xe2, 0xfd, 0xd7, 0xd7, 0xfd, 0xbb, 0xbc, 0xfc, 0x88, 0x8a,
+	0xfa, 0x5d, 0x62, 0xf9, 0x95, 0x3a, 0x42, 0xf9, 0x04, 0x5d, 0x62, 0xf9, 0x89, 0x8b, 0xfa, 0xbc,
+	0xbd, 0xfc, 0xd7, 0xd7, 0xfd, 0xe1, 0xe2, 0xfd, 0x97, 0xe4, 0xe4, 0xfe, 0x08, 0xe4, 0xe5, 0xfe,
+	0xdf, 0xe0, 0xfd, 0xdb, 0xdb, 0xfd, 0xd0, 0xd1, 0xfd, 0xbf, 0xc0, 0xfc, 0xa4, 0xa5, 0xfb, 0x83,
+	0x85, 0xfa, 0x6b, 0x6f, 0xfa, 0x44, 0x4a, 0xf9, 0xad, 0x3a, 0x42, 0xf9, 0xab, 0x3a, 0x42, 0xf9,
+	0x03, 0x46, 0x4c, 0xf9, 0xc2, 0xc3, 0xfc, 0xee, 0xee, 0xfe, 0xf7, 0xf7, 0xff, 0xa2, 0xff, 0xff,
+	0xff, 0x03, 0xf4, 0xf4, 0xfe, 0xc2, 0xc3, 0xfc, 0x3a, 0x42, 0xf9, 0x3d, 0x44, 0xf9, 0x8f, 0x3a,
+	0x42, 0xf9, 0x03, 0x3d, 0x44, 0xf9, 0x3a, 0x42, 0xf9, 0xc2, 0xc3, 0xfc, 0xf4, 0xf4, 0xfe, 0xa2,
+	0xff, 0xff, 0xff, 0x03, 0xf7, 0xf7, 0xff, 0xee, 0xee, 0xfe, 0xc2, 0xc3, 0xfc, 0x46, 0x4c, 0xf9,
+	0xab, 0x3a, 0x42, 0xf9, 0xa9, 0x3a, 0x42, 0xf9, 0x01, 0x60, 0x64, 0xf9, 0xbf, 0xc0, 0xfc, 0xa8,
+	0xff, 0xff, 0xff, 0x01, 0xdf, 0xdf, 0xfd, 0x4c, 0x52, 0xf9, 0x8f, 0x3a, 0x42, 0xf9, 0x01, 0x4e,
+	0x54, 0xf9, 0xdf, 0xdf, 0xfd, 0xa8, 0xff, 0xff, 0xff, 0x01, 0xbf, 0xc0, 0xfc, 0x60, 0x64, 0xf9,
+	0xa9, 0x3a, 0x42, 0xf9, 0xa8, 0x3a, 0x42, 0xf9, 0x01, 0xa9, 0xaa, 0xfb, 0xf6, 0xf7, 0xff, 0xaa,
+	0xff, 0xff, 0xff, 0x01, 0xe4, 0xe5, 0xfe, 0x48, 0x4e, 0xf9, 0x8d, 0x3a, 0x42, 0xf9, 0x01, 0x4a,
+	0x50, 0xf9, 0xe5, 0xe5, 0xfe, 0xaa, 0xff, 0xff, 0xff, 0x01, 0xf6, 0xf7, 0xff, 0xa8, 0xa9, 0xfb,
+	0xa8, 0x3a, 0x42, 0xf9, 0xa6, 0x3a, 0x42, 0xf9, 0x01, 0x3d, 0x44, 0xf9, 0xba, 0xbb, 0xfc, 0xad,
+	0xff, 0xff, 0xff, 0x00, 0xa3, 0xa4, 0xfb, 0x8d, 0x3a, 0x42, 0xf9, 0x00, 0xa4, 0xa5, 0xfb, 0xad,
+	0xff, 0xff, 0xff, 0x01, 0xba, 0xbb, 0xfc, 0x3d, 0x44, 0xf9, 0xa6, 0x3a, 0x42, 0xf9, 0xa6, 0x3a,
+	0x42, 0xf9, 0x00, 0xd8, 0xd9, 0xfd, 0xae, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xf9, 0xff, 0x8d, 0x3a,
+	0x42, 0xf9, 0x00, 0xf9, 0xfa, 0xff, 0xae, 0xff, 0xff, 0xff, 0x00, 0xd8, 0xd9, 0xfd, 0xa6, 0x3a,
+	0x42, 0xf9, 0xa5, 0x3a, 0x42, 0xf9, 0x00, 0xc7, 0xc7, 0xfc, 0xb0, 0xff, 0xff, 0xff, 0x00, 0x90,
+	0x92, 0xfb, 0x8b, 0x3a, 0x42, 0xf9, 0x00, 0x91, 0x93, 0xfb, 0xb0, 0xff, 0xff, 0xff, 0x00, 0xc7,
+	0xc7, 0xfc, 0xa5, 0x3a, 0x42, 0xf9, 0xa4, 0x3a, 0x42, 0xf9, 0x00, 0xc7, 0xc7, 0xfc, 0xb1, 0xff,
+	0xff, 0xff, 0x00, 0xc7, 0xc7, 0xfc, 0x8b, 0x3a, 0x42, 0xf9, 0x00, 0xc7, 0xc8, 0xfc, 0xb1, 0xff,
+	0xff, 0xff, 0x00, 0xc6, 0xc7, 0xfc, 0xa4, 0x3a, 0x42, 0xf9, 0xa3, 0x3a, 0x42, 0xf9, 0x01, 0x8c,
+	0x8f, 0xfa, 0xfe, 0xfe, 0xff, 0xb1, 0xff, 0xff, 0xff, 0x00, 0xdf, 0xdf, 0xfd, 0x8b, 0x3a, 0x42,
+	0xf9, 0x00, 0xdf, 0xdf, 0xfd, 0xb1, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xfe, 0xff, 0x8c, 0x8f, 0xfa,
+	0xa3, 0x3a, 0x42, 0xf9, 0xa3, 0x3a, 0x42, 0xf9, 0x00, 0xf9, 0xfa, 0xff, 0xb2, 0xff, 0xff, 0xff,
+	0x00, 0xe3, 0xe4, 0xfe, 0x8b, 0x3a, 0x42, 0xf9, 0x00, 0xe3, 0xe4, 0xfe, 0xb2, 0xff, 0xff, 0xff,
+	0x00, 0xf9, 0xfa, 0xff, 0xa3, 0x3a, 0x42, 0xf9, 0xa2, 0x3a, 0x42, 0xf9, 0x00, 0xd2, 0xd3, 0xfd,
+	0xb3, 0xff, 0xff, 0xff, 0x00, 0xe3, 0xe3, 0xfe, 0x8b, 0x3a, 0x42, 0xf9, 0x00, 0xe3, 0xe3, 0xfe,
+	0xb3, 0xff, 0xff, 0xff, 0x00, 0xd2, 0xd3, 0xfd, 0xa2, 0x3a, 0x42, 0xf9, 0xa1, 0x3a, 0x42, 0xf9,
+	0x01, 0x6a, 0x6e, 0xfa, 0xf9, 0xf9, 0xff, 0xb3, 0xff, 0xff, 0xff, 0x00, 0xd9, 0xd9, 0xfd, 0x8b,
+	0x3a, 0x42, 0xf9, 0x00, 0xd9, 0xda, 0xfd, 0xb3, 0xff, 0xff, 0xff, 0x01, 0xf8, 0xf8, 0xff, 0x6a,
+	0x6e, 0xfa, 0xa1, 0x3a, 0x42, 0xf9, 0xa1, 0x3a, 0x42, 0xf9, 0x00, 0xac, 0xad, 0xfb, 0xb4, 0xff,
+	0xff, 0xff, 0x00, 0xb8, 0xb9, 0xfc, 0x8b, 0x3a, 0x42, 0xf9, 0x00, 0xb8, 0xba, 0xfc, 0xb4, 0xff,
+	0xff, 0xff, 0x00, 0xab, 0xac, 0xfb, 0xa1, 0x3a, 0x42, 0xf9, 0xa1, 0x3a, 0x42, 0xf9, 0x00, 0xeb,
+	0xec, 0xfe, 0xb4, 0xff, 0xff, 0xff, 0x00, 0x69, 0x6c, 0xfa, 0x8b, 0x3a, 0x42, 0xf9, 0x00, 0x6b,
+	0x6f, 0xfa, 0xb4, 0xff, 0xff, 0xff, 0x00, 0xeb, 0xec, 0xfe, 0xa1, 0x3a, 0x42, 0xf9, 0xa0, 0x3a,
+	0x42, 0xf9, 0x00, 0x41, 0x48, 0xf9, 0xb4, 0xff, 0xff, 0xff, 0x00, 0xe4, 0xe5, 0xfe, 0x8d, 0x3a,
+	0x42, 0xf9, 0x00, 0xe5, 0xe5, 0xfe, 0xb4, 0xff, 0xff, 0xff, 0x00, 0x3f, 0x46, 0xf9, 0xa0, 0x3a,
+	0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0x91, 0x93, 0xfb, 0xb3, 0xff, 0xff, 0xff, 0x01, 0xfd,
+	0xfd, 0xff, 0x83, 0x85, 0xfa, 0x8d, 0x3a, 0x42, 0xf9, 0x01, 0x84, 0x86, 0xfa, 0xfd, 0xfd, 0xff,
+	0xb3, 0xff, 0xff, 0xff, 0x00, 0x90, 0x92, 0xfb, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9,
+	0x00, 0xb2, 0xb3, 0xfc, 0xb3, 0xff, 0xff, 0xff, 0x00, 0xc6, 0xc7, 0xfc, 0x8f, 0x3a, 0x42, 0xf9,
+	0x00, 0xc6, 0xc7, 0xfc, 0xb3, 0xff, 0xff, 0xff, 0x00, 0xb1, 0xb2, 0xfc, 0xa0, 0x3a, 0x42, 0xf9,
+	0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xc5, 0xc6, 0xfc, 0xb2, 0xff, 0xff, 0xff, 0x00, 0xa9, 0xaa, 0xfb,
+	0x91, 0x3a, 0x42, 0xf9, 0x00, 0xa9, 0xaa, 0xfb, 0xb2, 0xff, 0xff, 0xff, 0x00, 0xc4, 0xc4, 0xfc,
+	0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xd0, 0xd0, 0xfd, 0xae, 0xff, 0xff, 0xff,
+	0x03, 0xfe, 0xfe, 0xff, 0xf4, 0xf4, 0xfe, 0xdd, 0xdd, 0xfd, 0x6e, 0x71, 0xfa, 0x93, 0x3a, 0x42,
+	0xf9, 0x03, 0x6e, 0x71, 0xfa, 0xdd, 0xdd, 0xfd, 0xf4, 0xf4, 0xfe, 0xfd, 0xfd, 0xff, 0xae, 0xff,
+	0xff, 0xff, 0x00, 0xcf, 0xd0, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xd5,
+	0xd5, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xf2, 0xf3, 0xfe, 0xa9, 0xab, 0xfb, 0x98, 0xaa, 0xac,
+	0xfb, 0x03, 0xa4, 0xa5, 0xfb, 0x93, 0x96, 0xfb, 0x7d, 0x7f, 0xfa, 0x60, 0x64, 0xf9, 0x97, 0x3a,
+	0x42, 0xf9, 0x03, 0x60, 0x64, 0xf9, 0x7c, 0x7e, 0xfa, 0x93, 0x96, 0xfb, 0xa3, 0xa4, 0xfb, 0x98,
+	0xaa, 0xac, 0xfb, 0x01, 0xa9, 0xab, 0xfb, 0xf2, 0xf3, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xd5,
+	0xd5, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xd8, 0xd9, 0xfd, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xd6, 0xd7, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xdb,
+	0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea,
+	0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a,
+	0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a,
+	0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0xa0, 0x3a,
+	0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea,
+	0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb,
+	0xdc, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xdb,
+	0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea,
+	0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0x84, 0x3a,
+	0x42, 0xf9, 0x03, 0x46, 0x4c, 0xf9, 0x5c, 0x60, 0xf9, 0x63, 0x67, 0xfa, 0x66, 0x6a, 0xfa, 0x86,
+	0x64, 0x68, 0xfa, 0x01, 0x60, 0x64, 0xf9, 0x3d, 0x44, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb,
+	0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea,
+	0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x3d,
+	0x44, 0xf9, 0x60, 0x64, 0xf9, 0x86, 0x64, 0x68, 0xfa, 0x03, 0x66, 0x6a, 0xfa, 0x63, 0x67, 0xfa,
+	0x5c, 0x60, 0xf9, 0x46, 0x4c, 0xf9, 0x84, 0x3a, 0x42, 0xf9, 0x82, 0x3a, 0x42, 0xf9, 0x04, 0x8b,
+	0x8d, 0xfa, 0xd6, 0xd7, 0xfd, 0xed, 0xed, 0xfe, 0xf2, 0xf3, 0xfe, 0xf5, 0xf5, 0xfe, 0x87, 0xf6,
+	0xf6, 0xfe, 0x01, 0xe8, 0xe8, 0xfe, 0x53, 0x59, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc,
+	0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea,
+	0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x53, 0x59,
+	0xf9, 0xe8, 0xe8, 0xfe, 0x87, 0xf6, 0xf6, 0xfe, 0x04, 0xf5, 0xf5, 0xfe, 0xf2, 0xf3, 0xfe, 0xed,
+	0xed, 0xfe, 0xd6, 0xd7, 0xfd, 0x8a, 0x8c, 0xfa, 0x82, 0x3a, 0x42, 0xf9, 0x80, 0x3a, 0x42, 0xf9,
+	0x01, 0x6f, 0x72, 0xfa, 0xe0, 0xe1, 0xfd, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55,
+	0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea,
+	0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb,
+	0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x8c, 0xff, 0xff,
+	0xff, 0x01, 0xe0, 0xe1, 0xfd, 0x6f, 0x72, 0xfa, 0x80, 0x3a, 0x42, 0xf9, 0x03, 0x3a, 0x42, 0xf9,
+	0x3a, 0x42, 0xf9, 0x89, 0x8b, 0xfa, 0xf9, 0xfa, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1,
+	0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff,
+	0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff,
+	0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x8d,
+	0xff, 0xff, 0xff, 0x03, 0xf9, 0xfa, 0xff, 0x89, 0x8b, 0xfa, 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9,
+	0x01, 0x3a, 0x42, 0xf9, 0x66, 0x6a, 0xfa, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55,
+	0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea,
+	0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb,
+	0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x8f, 0xff, 0xff,
+	0xff, 0x01, 0x66, 0x6a, 0xfa, 0x3a, 0x42, 0xf9, 0x01, 0x41, 0x48, 0xf9, 0xe5, 0xe6, 0xfe, 0x8f,
+	0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb,
+	0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea,
+	0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55,
+	0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xe5, 0xe6, 0xfe, 0x41, 0x48, 0xf9,
+	0x01, 0x77, 0x7a, 0xfa, 0xfc, 0xfc, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55,
+	0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea,
+	0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb,
+	0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x8f, 0xff, 0xff,
+	0xff, 0x01, 0xfb, 0xfb, 0xff, 0x77, 0x7a, 0xfa, 0x00, 0xac, 0xad, 0xfb, 0x90, 0xff, 0xff, 0xff,
+	0x01, 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f,
+	0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f,
+	0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1,
+	0xf1, 0xfe, 0x90, 0xff, 0xff, 0xff, 0x00, 0xab, 0xac, 0xfb, 0x00, 0xd2, 0xd3, 0xfd, 0x90, 0xff,
+	0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc,
+	0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea,
+	0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a,
+	0xf9, 0xf1, 0xf1, 0xfe, 0x90, 0xff, 0xff, 0xff, 0x00, 0xd1, 0xd2, 0xfd, 0x00, 0xe5, 0xe5, 0xfe,
+	0x90, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00,
+	0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00,
+	0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01,
+	0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x90, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xe5, 0xfe, 0x00, 0xeb,
+	0xeb, 0xfe, 0x90, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42,
+	0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42,
+	0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42,
+	0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x90, 0xff, 0xff, 0xff, 0x00, 0xe9, 0xe9, 0xfe,
+	0x00, 0xe8, 0xe8, 0xfe, 0x90, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a,
+	0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7,
+	0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a,
+	0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x90, 0xff, 0xff, 0xff, 0x00, 0xe7,
+	0xe8, 0xfe, 0x00, 0xd9, 0xd9, 0xfd, 0x90, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55, 0x5a,
+	0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea,
+	0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc,
+	0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x90, 0xff, 0xff, 0xff,
+	0x00, 0xd8, 0xd9, 0xfd, 0x00, 0xb8, 0xba, 0xfc, 0x90, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe,
+	0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00,
+	0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00,
+	0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x90, 0xff,
+	0xff, 0xff, 0x00, 0xb8, 0xba, 0xfc, 0x00, 0x81, 0x83, 0xfa, 0x90, 0xff, 0xff, 0xff, 0x01, 0xf1,
+	0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff,
+	0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff,
+	0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe,
+	0x90, 0xff, 0xff, 0xff, 0x00, 0x81, 0x83, 0xfa, 0x01, 0x4e, 0x54, 0xf9, 0xf1, 0xf1, 0xfe, 0x8f,
+	0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb,
+	0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea,
+	0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55,
+	0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x4e, 0x54, 0xf9,
+	0x01, 0x3a, 0x42, 0xf9, 0xa0, 0xa1, 0xfb, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55,
+	0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea,
+	0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb,
+	0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x8f, 0xff, 0xff,
+	0xff, 0x01, 0xa0, 0xa1, 0xfb, 0x3a, 0x42, 0xf9, 0x02, 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9, 0xb2,
+	0xb4, 0xfc, 0x8e, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42,
+	0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42,
+	0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42,
+	0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x8e, 0xff, 0xff, 0xff, 0x02, 0xb2, 0xb4, 0xfc,
+	0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9, 0x80, 0x3a, 0x42, 0xf9, 0x01, 0xb6, 0xb7, 0xfc, 0xf7, 0xf7,
+	0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9,
+	0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9,
+	0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9,
+	0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xf7, 0xf7, 0xff, 0xb6,
+	0xb7, 0xfc, 0x80, 0x3a, 0x42, 0xf9, 0x81, 0x3a, 0x42, 0xf9, 0x02, 0x64, 0x68, 0xfa, 0xb2, 0xb3,
+	0xfc, 0xee, 0xef, 0xfe, 0x8a, 0xff, 0xff, 0xff, 0x01, 0xf5, 0xf5, 0xfe, 0x57, 0x5c, 0xf9, 0x8a,
+	0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7,
+	0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a,
+	0x3a, 0x42, 0xf9, 0x01, 0x57, 0x5c, 0xf9, 0xf5, 0xf5, 0xfe, 0x8a, 0xff, 0xff, 0xff, 0x02, 0xee,
+	0xef, 0xfe, 0xb2, 0xb3, 0xfc, 0x64, 0x68, 0xfa, 0x81, 0x3a, 0x42, 0xf9, 0x84, 0x3a, 0x42, 0xf9,
+	0x02, 0x44, 0x4a, 0xf9, 0x82, 0x84, 0xfa, 0x96, 0x98, 0xfb, 0x87, 0x98, 0x9a, 0xfb, 0x01, 0x90,
+	0x92, 0xfb, 0x44, 0x4a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff,
+	0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff,
+	0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x44, 0x4a, 0xf9, 0x90, 0x92, 0xfb,
+	0x87, 0x98, 0x9a, 0xfb, 0x02, 0x96, 0x98, 0xfb, 0x82, 0x84, 0xfa, 0x41, 0x48, 0xf9, 0x84, 0x3a,
+	0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea,
+	0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb,
+	0xdc, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xdb,
+	0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea,
+	0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a,
+	0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a,
+	0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0xa0, 0x3a,
+	0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea,
+	0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb,
+	0xdc, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xdb,
+	0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea,
+	0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a,
+	0x42, 0xf9, 0x00, 0xe0, 0xe0, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a,
+	0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xe0, 0xe0, 0xfd, 0xa0, 0x3a,
+	0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xe8, 0xe9, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xe8,
+	0xe9, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xe7, 0xe7, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xe8,
+	0xe9, 0xfe, 0xa0, 0x3a, 0x42, 0xf9, 0x9f, 0x3a, 0x42, 0xf9, 0x01, 0x46, 0x4c, 0xf9, 0xed, 0xed,
+	0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xe4, 0xe4, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xe2, 0xe2,
+	0xfe, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xed, 0xed, 0xfe, 0x44, 0x4a, 0xf9, 0x9f, 0x3a, 0x42, 0xf9,
+	0x9f, 0x3a, 0x42, 0xf9, 0x01, 0x5d, 0x62, 0xf9, 0xf3, 0xf3, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00,
+	0xdd, 0xde, 0xfd, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xd8, 0xd8, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x01,
+	0xf3, 0xf3, 0xfe, 0x5d, 0x62, 0xf9, 0x9f, 0x3a, 0x42, 0xf9, 0x9f, 0x3a, 0x42, 0xf9, 0x01, 0x74,
+	0x77, 0xfa, 0xfb, 0xfb, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xcd, 0xce, 0xfd, 0xd7, 0x3a, 0x42,
+	0xf9, 0x00, 0xc3, 0xc4, 0xfc, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xfb, 0xfb, 0xff, 0x74, 0x77, 0xfa,
+	0x9f, 0x3a, 0x42, 0xf9, 0x9f, 0x3a, 0x42, 0xf9, 0x00, 0xa1, 0xa2, 0xfb, 0x90, 0xff, 0xff, 0xff,
+	0x00, 0xb6, 0xb7, 0xfc, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xa7, 0xa9, 0xfb, 0x90, 0xff, 0xff, 0xff,
+	0x00, 0xa1, 0xa2, 0xfb, 0x9f, 0x3a, 0x42, 0xf9, 0x9f, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe,
+	0x90, 0xff, 0xff, 0xff, 0x00, 0x93, 0x96, 0xfb, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0x79, 0x7c, 0xfa,
+	0x90, 0xff, 0xff, 0xff, 0x00, 0xe9, 0xe9, 0xfe, 0x9f, 0x3a, 0x42, 0xf9, 0x9e, 0x3a, 0x42, 0xf9,
+	0x00, 0xad, 0xae, 0xfb, 0x91, 0xff, 0xff, 0xff, 0x00, 0x50, 0x55, 0xf9, 0xd8, 0x3a, 0x42, 0xf9,
+	0x91, 0xff, 0xff, 0xff, 0x00, 0xad, 0xae, 0xfb, 0x9e, 0x3a, 0x42, 0xf9, 0x9d, 0x3a, 0x42, 0xf9,
+	0x01, 0x7f, 0x81, 0xfa, 0xf9, 0xf9, 0xff, 0x90, 0xff, 0xff, 0xff, 0x00, 0xf7, 0xf7, 0xff, 0xd9,
+	0x3a, 0x42, 0xf9, 0x00, 0xe3, 0xe4, 0xfe, 0x90, 0xff, 0xff, 0xff, 0x01, 0xf9, 0xf9, 0xff, 0x7f,
+	0x81, 0xfa, 0x9d, 0x3a, 0x42, 0xf9, 0x9c, 0x3a, 0x42, 0xf9, 0x01, 0xae, 0xb0, 0xfb, 0xf9, 0xfa,
+	0xff, 0x91, 0xff, 0xff, 0xff, 0x00, 0xcf, 0xd0, 0xfd, 0xd9, 0x3a, 0x42, 0xf9, 0x00, 0xb1, 0xb2,
+	0xfc, 0x91, 0xff, 0xff, 0xff, 0x01, 0xf9, 0xfa, 0xff, 0xae, 0xaf, 0xfb, 0x9c, 0x3a, 0x42, 0xf9,
+	0x97, 0x3a, 0x42, 0xf9, 0x04, 0x4a, 0x50, 0xf9, 0x5f, 0x63, 0xf9, 0x75, 0x78, 0xfa, 0xa4, 0xa6,
+	0xfb, 0xeb, 0xeb, 0xfe, 0x93, 0xff, 0xff, 0xff, 0x00, 0x93, 0x96, 0xfb, 0xd9, 0x3a, 0x42, 0xf9,
+	0x01, 0x77, 0x7a, 0xfa, 0xfd, 0xfd, 0xff, 0x92, 0xff, 0xff, 0xff, 0x04, 0xeb, 0xeb, 0xfe, 0xa4,
+	0xa5, 0xfb, 0x75, 0x78, 0xfa, 0x5f, 0x63, 0xf9, 0x48, 0x4e, 0xf9, 0x97, 0x3a, 0x42, 0xf9, 0x83,
+	0x3a, 0x42, 0xf9, 0x02, 0x7a, 0x7d, 0xfa, 0xbb, 0xbc, 0xfc, 0xd6, 0xd7, 0xfd, 0x8b, 0xdd, 0xdd,
+	0xfd, 0x05, 0xe0, 0xe1, 0xfd, 0xe4, 0xe4, 0xfe, 0xea, 0xea, 0xfe, 0xee, 0xee, 0xfe, 0xf3, 0xf3,
+	0xfe, 0xfb, 0xfb, 0xff, 0x94, 0xff, 0xff, 0xff, 0x01, 0xf7, 0xf7, 0xff, 0x69, 0x6c, 0xfa, 0xd9,
+	0x3a, 0x42, 0xf9, 0x01, 0x50, 0x55, 0xf9, 0xf1, 0xf1, 0xfe, 0x94, 0xff, 0xff, 0xff, 0x05, 0xfb,
+	0xfb, 0xff, 0xf3, 0xf3, 0xfe, 0xee, 0xee, 0xfe, 0xea, 0xea, 0xfe, 0xe4, 0xe4, 0xfe, 0xe0, 0xe1,
+	0xfd, 0x8b, 0xdd, 0xdd, 0xfd, 0x02, 0xd6, 0xd6, 0xfd, 0xbb, 0xbc, 0xfc, 0x7a, 0x7d, 0xfa, 0x83,
+	0x3a, 0x42, 0xf9, 0x80, 0x3a, 0x42, 0xf9, 0x02, 0x46, 0x4c, 0xf9, 0x9a, 0x9c, 0xfb, 0xf2, 0xf2,
+	0xfe, 0xab, 0xff, 0xff, 0xff, 0x00, 0xe3, 0xe4, 0xfe, 0xdb, 0x3a, 0x42, 0xf9, 0x00, 0xc7, 0xc8,
+	0xfc, 0xab, 0xff, 0xff, 0xff, 0x02, 0xf2, 0xf2, 0xfe, 0x9a, 0x9c, 0xfb, 0x46, 0x4c, 0xf9, 0x80,
+	0x3a, 0x42, 0xf9, 0x03, 0x3a, 0x42, 0xf9, 0x3d, 0x44, 0xf9, 0x4c, 0x52, 0xf9, 0xe3, 0xe3, 0xfe,
+	0xad, 0xff, 0xff, 0xff, 0x00, 0x8f, 0x91, 0xfa, 0xdb, 0x3a, 0x42, 0xf9, 0x00, 0x44, 0x4a, 0xf9,
+	0xad, 0xff, 0xff, 0xff, 0x03, 0xe3, 0xe3, 0xfe, 0x4c, 0x52, 0xf9, 0x3d, 0x44, 0xf9, 0x3a, 0x42,
+	0xf9, 0x02, 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9, 0xe2, 0xe2, 0xfe, 0xad, 0xff, 0xff, 0xff, 0x00,
+	0xe8, 0xe8, 0xfe, 0xdd, 0x3a, 0x42, 0xf9, 0x00, 0xc0, 0xc1, 0xfc, 0xad, 0xff, 0xff, 0xff, 0x02,
+	0xe2, 0xe2, 0xfe, 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9, 0x01, 0x3a, 0x42, 0xf9, 0xcc, 0xcc, 0xfd,
+	0xad, 0xff, 0xff, 0xff, 0x01, 0xfd, 0xfd, 0xff, 0x85, 0x87, 0xfa, 0xdd, 0x3a, 0x42, 0xf9, 0x01,
+	0x66, 0x6a, 0xfa, 0xf7, 0xf7, 0xff, 0xad, 0xff, 0xff, 0xff, 0x01, 0xcb, 0xcc, 0xfd, 0x3a, 0x42,
+	0xf9, 0x01, 0x66, 0x6a, 0xfa, 0xf6, 0xf7, 0xff, 0xad, 0xff, 0xff, 0xff, 0x00, 0xde, 0xde, 0xfd,
+	0xdf, 0x3a, 0x42, 0xf9, 0x00, 0xc0, 0xc1, 0xfc, 0xad, 0xff, 0xff, 0xff, 0x01, 0xf6, 0xf7, 0xff,
+	0x66, 0x6a, 0xfa, 0x00, 0x96, 0x98, 0xfb, 0xad, 0xff, 0xff, 0xff, 0x01, 0xfa, 0xfa, 0xff, 0x4a,
+	0x50, 0xf9, 0xe0, 0x3a, 0x42, 0xf9, 0x00, 0xe5, 0xe5, 0xfe, 0xad, 0xff, 0xff, 0xff, 0x00, 0x95,
+	0x97, 0xfb, 0x00, 0xc7, 0xc8, 0xfc, 0xac, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xfe, 0xff, 0x86, 0x88,
+	0xfa, 0xe1, 0x3a, 0x42, 0xf9, 0x01, 0x6b, 0x6f, 0xfa, 0xf9, 0xf9, 0xff, 0xac, 0xff, 0xff, 0xff,
+	0x00, 0xc7, 0xc8, 0xfc, 0x00, 0xdf, 0xe0, 0xfd, 0xac, 0xff, 0xff, 0xff, 0x00, 0xb3, 0xb4, 0xfc,
+	0xe3, 0x3a, 0x42, 0xf9, 0x00, 0x9d, 0x9e, 0xfb, 0xac, 0xff, 0xff, 0xff, 0x00, 0xdf, 0xdf, 0xfd,
+	0x00, 0xea, 0xea, 0xfe, 0xab, 0xff, 0xff, 0xff, 0x00, 0xc0, 0xc1, 0xfc, 0xe5, 0x3a, 0x42, 0xf9,
+	0x00, 0xb6, 0xb8, 0xfc, 0xab, 0xff, 0xff, 0xff, 0x00, 0xe9, 0xe9, 0xfe, 0x00, 0xea, 0xea, 0xfe,
+	0xab, 0xff, 0xff, 0xff, 0x00, 0xb4, 0xb5, 0xfc, 0xe5, 0x3a, 0x42, 0xf9, 0x00, 0xbe, 0xbf, 0xfc,
+	0xab, 0xff, 0xff, 0xff, 0x00, 0xe9, 0xe9, 0xfe, 0x00, 0xdf, 0xe0, 0xfd, 0xac, 0xff, 0xff, 0xff,
+	0x00, 0x99, 0x9b, 0xfb, 0xe3, 0x3a, 0x42, 0xf9, 0x00, 0xb1, 0xb2, 0xfc, 0xac, 0xff, 0xff, 0xff,
+	0x00, 0xdf, 0xe0, 0xfd, 0x00, 0xc8, 0xc9, 0xfc, 0xac, 0xff, 0xff, 0xff, 0x01, 0xf9, 0xf9, 0xff,
+	0x69, 0x6c, 0xfa, 0xe1, 0x3a, 0x42, 0xf9, 0x01, 0x84, 0x86, 0xfa, 0xfd, 0xfd, 0xff, 0xac, 0xff,
+	0xff, 0xff, 0x00, 0xc7, 0xc8, 0xfc, 0x00, 0x96, 0x98, 0xfb, 0xad, 0xff, 0xff, 0xff, 0x00, 0xe2,
+	0xe3, 0xfe, 0xe0, 0x3a, 0x42, 0xf9, 0x01, 0x48, 0x4e, 0xf9, 0xfa, 0xfa, 0xff, 0xad, 0xff, 0xff,
+	0xff, 0x00, 0x96, 0x98, 0xfb, 0x01, 0x66, 0x6a, 0xfa, 0xf7, 0xf7, 0xff, 0xad, 0xff, 0xff, 0xff,
+	0x00, 0xbe, 0xbf, 0xfc, 0xdf, 0x3a, 0x42, 0xf9, 0x00, 0xdd, 0xdd, 0xfd, 0xad, 0xff, 0xff, 0xff,
+	0x01, 0xf7, 0xf7, 0xff, 0x66, 0x6a, 0xfa, 0x01, 0x3a, 0x42, 0xf9, 0xcd, 0xce, 0xfd, 0xad, 0xff,
+	0xff, 0xff, 0x01, 0xf7, 0xf7, 0xff, 0x64, 0x68, 0xfa, 0xdd, 0x3a, 0x42, 0xf9, 0x01, 0x85, 0x87,
+	0xfa, 0xfd, 0xfd, 0xff, 0xad, 0xff, 0xff, 0xff, 0x01, 0xcd, 0xce, 0xfd, 0x3a, 0x42, 0xf9, 0x02,
+	0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9, 0xe4, 0xe5, 0xfe, 0xad, 0xff, 0xff, 0xff, 0x00, 0xbc, 0xbd,
+	0xfc, 0xdd, 0x3a, 0x42, 0xf9, 0x00, 0xe6, 0xe6, 0xfe, 0xad, 0xff, 0xff, 0xff, 0x02, 0xe4, 0xe4,
+	0xfe, 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9, 0x03, 0x3a, 0x42, 0xf9, 0x3d, 0x44, 0xf9, 0x4e, 0x54,
+	0xf9, 0xe4, 0xe5, 0xfe, 0xad, 0xff, 0xff, 0xff, 0x00, 0x41, 0x48, 0xf9, 0xdb, 0x3a, 0x42, 0xf9,
+	0x00, 0x8d, 0x90, 0xfa, 0xad, 0xff, 0xff, 0xff, 0x03, 0xe4, 0xe4, 0xfe, 0x4e, 0x54, 0xf9, 0x3d,
+	0x44, 0xf9, 0x3a, 0x42, 0xf9, 0x80, 0x3a, 0x42, 0xf9, 0x02, 0x48, 0x4e, 0xf9, 0x9d, 0x9f, 0xfb,
+	0xf4, 0xf4, 0xfe, 0xab, 0xff, 0xff, 0xff, 0x00, 0xc5, 0xc6, 0xfc, 0xdb, 0x3a, 0x42, 0xf9, 0x00,
+	0xe3, 0xe4, 0xfe, 0xab, 0xff, 0xff, 0xff, 0x02, 0xf4, 0xf4, 0xfe, 0x9d, 0x9f, 0xfb, 0x48, 0x4e,
+	0xf9, 0x80, 0x3a, 0x42, 0xf9, 0x83, 0x3a, 0x42, 0xf9, 0x03, 0x81, 0x83, 0xfa, 0xbe, 0xbf, 0xfc,
+	0xd8, 0xd9, 0xfd, 0xe1, 0xe1, 0xfd, 0x8b, 0xe1, 0xe2, 0xfd, 0x04, 0xe7, 0xe7, 0xfe, 0xea, 0xea,
+	0xfe, 0xee, 0xef, 0xfe, 0xf4, 0xf4, 0xfe, 0xfc, 0xfc, 0xff, 0x94, 0xff, 0xff, 0xff, 0x01, 0xf0,
+	0xf0, 0xfe, 0x4e, 0x54, 0xf9, 0xd9, 0x3a, 0x42, 0xf9, 0x01, 0x69, 0x6c, 0xfa, 0xf7, 0xf7, 0xff,
+	0x94, 0xff, 0xff, 0xff, 0x04, 0xfc, 0xfc, 0xff, 0xf4, 0xf4, 0xfe, 0xee, 0xef, 0xfe, 0xea, 0xea,
+	0xfe, 0xe7, 0xe7, 0xfe, 0x8b, 0xe1, 0xe2, 0xfd, 0x03, 0xe1, 0xe1, 0xfd, 0xd8, 0xd9, 0xfd, 0xbe,
+	0xbf, 0xfc, 0x81, 0x83, 0xfa, 0x83, 0x3a, 0x42, 0xf9, 0x97, 0x3a, 0x42, 0xf9, 0x04, 0x4c, 0x52,
+	0xf9, 0x60, 0x64, 0xf9, 0x76, 0x79, 0xfa, 0xa7, 0xa9, 0xfb, 0xed, 0xed, 0xfe, 0x92, 0xff, 0xff,
+	0xff, 0x01, 0xfd, 0xfd, 0xff, 0x77, 0x7a, 0xfa, 0xd9, 0x3a, 0x42, 0xf9, 0x00, 0x93, 0x96, 0xfb,
+	0x93, 0xff, 0xff, 0xff, 0x04, 0xed, 0xed, 0xfe, 0xa7, 0xa8, 0xfb, 0x76, 0x79, 0xfa, 0x60, 0x64,
+	0xf9, 0x4c, 0x52, 0xf9, 0x97, 0x3a, 0x42, 0xf9, 0x9c, 0x3a, 0x42, 0xf9, 0x01, 0xb2, 0xb3, 0xfc,
+	0xf9, 0xfa, 0xff, 0x91, 0xff, 0xff, 0xff, 0x00, 0xb0, 0xb1, 0xfb, 0xd9, 0x3a, 0x42, 0xf9, 0x00,
+	0xcf, 0xcf, 0xfd, 0x91, 0xff, 0xff, 0xff, 0x01, 0xf9, 0xfa, 0xff, 0xb1, 0xb2, 0xfc, 0x9c, 0x3a,
+	0x42, 0xf9, 0x9d, 0x3a, 0x42, 0xf9, 0x01, 0x81, 0x83, 0xfa, 0xf9, 0xfa, 0xff, 0x90, 0xff, 0xff,
+	0xff, 0x00, 0xe2, 0xe2, 0xfe, 0xd9, 0x3a, 0x42, 0xf9, 0x00, 0xf7, 0xf7, 0xff, 0x90, 0xff, 0xff,
+	0xff, 0x01, 0xf9, 0xfa, 0xff, 0x80, 0x82, 0xfa, 0x9d, 0x3a, 0x42, 0xf9, 0x9e, 0x3a, 0x42, 0xf9,
+	0x00, 0xb0, 0xb1, 0xfb, 0x91, 0xff, 0xff, 0xff, 0xd8, 0x3a, 0x42, 0xf9, 0x00, 0x50, 0x55, 0xf9,
+	0x91, 0xff, 0xff, 0xff, 0x00, 0xaf, 0xb0, 0xfb, 0x9e, 0x3a, 0x42, 0xf9, 0x9f, 0x3a, 0x42, 0xf9,
+	0x00, 0xeb, 0xeb, 0xfe, 0x90, 0xff, 0xff, 0xff, 0x00, 0x78, 0x7b, 0xfa, 0xd7, 0x3a, 0x42, 0xf9,
+	0x00, 0x93, 0x96, 0xfb, 0x90, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0x9f, 0x3a, 0x42, 0xf9,
+	0x9f, 0x3a, 0x42, 0xf9, 0x00, 0xa3, 0xa4, 0xfb, 0x90, 0xff, 0xff, 0xff, 0x00, 0xa7, 0xa8, 0xfb,
+	0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xb6, 0xb7, 0xfc, 0x90, 0xff, 0xff, 0xff, 0x00, 0xa2, 0xa4, 0xfb,
+	0x9f, 0x3a, 0x42, 0xf9, 0x9f, 0x3a, 0x42, 0xf9, 0x01, 0x74, 0x77, 0xfa, 0xfb, 0xfb, 0xff, 0x8f,
+	0xff, 0xff, 0xff, 0x00, 0xc2, 0xc3, 0xfc, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xcd, 0xce, 0xfd, 0x8f,
+	0xff, 0xff, 0xff, 0x01, 0xfb, 0xfb, 0xff, 0x74, 0x77, 0xfa, 0x9f, 0x3a, 0x42, 0xf9, 0x9f, 0x3a,
+	0x42, 0xf9, 0x01, 0x5d, 0x62, 0xf9, 0xf3, 0xf3, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xd7, 0xd8,
+	0xfd, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xdd, 0xde, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xf3, 0xf3,
+	0xfe, 0x5d, 0x62, 0xf9, 0x9f, 0x3a, 0x42, 0xf9, 0x9f, 0x3a, 0x42, 0xf9, 0x01, 0x46, 0x4c, 0xf9,
+	0xed, 0xed, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xe1, 0xe2, 0xfd, 0xd7, 0x3a, 0x42, 0xf9, 0x00,
+	0xe4, 0xe4, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xed, 0xed, 0xfe, 0x46, 0x4c, 0xf9, 0x9f, 0x3a,
+	0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xe8, 0xe9, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xe6,
+	0xe7, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xe8, 0xe9, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xe8,
+	0xe9, 0xfe, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xe0, 0xe1, 0xfd, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xe0, 0xe0, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xdb,
+	0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea,
+	0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a,
+	0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a,
+	0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0xa0, 0x3a,
+	0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea,
+	0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb,
+	0xdc, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xdb,
+	0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea,
+	0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a,
+	0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a,
+	0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0xa0, 0x3a,
+	0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea,
+	0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb,
+	0xdc, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0x85, 0x3a, 0x42, 0xf9, 0x00, 0x7e, 0x80, 0xfa, 0x88, 0x8e,
+	0x90, 0xfa, 0x01, 0x87, 0x89, 0xfa, 0x41, 0x48, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc,
+	0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea,
+	0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x41, 0x48,
+	0xf9, 0x87, 0x89, 0xfa, 0x88, 0x8e, 0x90, 0xfa, 0x00, 0x7e, 0x80, 0xfa, 0x85, 0x3a, 0x42, 0xf9,
+	0x81, 0x3a, 0x42, 0xf9, 0x02, 0x63, 0x67, 0xfa, 0xaf, 0xb0, 0xfb, 0xec, 0xed, 0xfe, 0x8a, 0xff,
+	0xff, 0xff, 0x01, 0xf6, 0xf6, 0xfe, 0x57, 0x5c, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc,
+	0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea,
+	0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x57, 0x5c,
+	0xf9, 0xf6, 0xf6, 0xfe, 0x8a, 0xff, 0xff, 0xff, 0x02, 0xec, 0xec, 0xfe, 0xaf, 0xb0, 0xfb, 0x63,
+	0x67, 0xfa, 0x81, 0x3a, 0x42, 0xf9, 0x80, 0x3a, 0x42, 0xf9, 0x01, 0xb3, 0xb4, 0xfc, 0xf7, 0xf7,
+	0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9,
+	0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9,
+	0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9,
+	0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xf7, 0xf7, 0xff, 0xb2,
+	0xb4, 0xfc, 0x80, 0x3a, 0x42, 0xf9, 0x02, 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9, 0xb0, 0xb1, 0xfb,
+	0x8e, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00,
+	0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00,
+	0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01,
+	0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x8e, 0xff, 0xff, 0xff, 0x02, 0xb0, 0xb1, 0xfb, 0x3a, 0x42,
+	0xf9, 0x3a, 0x42, 0xf9, 0x01, 0x3a, 0x42, 0xf9, 0x9d, 0x9e, 0xfb, 0x8f, 0xff, 0xff, 0xff, 0x01,
+	0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1,
+	0xfe, 0x8f, 0xff, 0xff, 0xff, 0x01, 0x9d, 0x9e, 0xfb, 0x3a, 0x42, 0xf9, 0x01, 0x4e, 0x54, 0xf9,
+	0xf1, 0xf1, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a,
+	0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a,
+	0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a,
+	0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1,
+	0xfe, 0x4c, 0x52, 0xf9, 0x00, 0x80, 0x82, 0xfa, 0x90, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe,
+	0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00,
+	0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00,
+	0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x90, 0xff,
+	0xff, 0xff, 0x00, 0x80, 0x82, 0xfa, 0x00, 0xb8, 0xb9, 0xfc, 0x90, 0xff, 0xff, 0xff, 0x01, 0xf1,
+	0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff,
+	0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff,
+	0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe,
+	0x90, 0xff, 0xff, 0xff, 0x00, 0xb7, 0xb8, 0xfc, 0x00, 0xd8, 0xd9, 0xfd, 0x90, 0xff, 0xff, 0xff,
+	0x01, 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f,
+	0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f,
+	0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1,
+	0xf1, 0xfe, 0x90, 0xff, 0xff, 0xff, 0x00, 0xd8, 0xd9, 0xfd, 0x00, 0xe8, 0xe8, 0xfe, 0x90, 0xff,
+	0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc,
+	0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea,
+	0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a,
+	0xf9, 0xf1, 0xf1, 0xfe, 0x90, 0xff, 0xff, 0xff, 0x00, 0xe7, 0xe7, 0xfe, 0x00, 0xeb, 0xec, 0xfe,
+	0x90, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00,
+	0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00,
+	0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01,
+	0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x90, 0xff, 0xff, 0xff, 0x00, 0xe9, 0xe9, 0xfe, 0x00, 0xe5,
+	0xe5, 0xfe, 0x90, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42,
+	0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42,
+	0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42,
+	0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x90, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xe5, 0xfe,
+	0x00, 0xd2, 0xd3, 0xfd, 0x90, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a,
+	0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7,
+	0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a,
+	0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x90, 0xff, 0xff, 0xff, 0x00, 0xd2,
+	0xd3, 0xfd, 0x00, 0xac, 0xae, 0xfb, 0x90, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55, 0x5a,
+	0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea,
+	0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc,
+	0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x90, 0xff, 0xff, 0xff,
+	0x00, 0xac, 0xad, 0xfb, 0x01, 0x78, 0x7b, 0xfa, 0xfc, 0xfc, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x01,
+	0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1,
+	0xfe, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xfc, 0xfc, 0xff, 0x77, 0x7a, 0xfa, 0x01, 0x41, 0x48, 0xf9,
+	0xe6, 0xe6, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a,
+	0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a,
+	0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a,
+	0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xe6, 0xe6,
+	0xfe, 0x41, 0x48, 0xf9, 0x01, 0x3a, 0x42, 0xf9, 0x69, 0x6c, 0xfa, 0x8f, 0xff, 0xff, 0xff, 0x01,
+	0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1,
+	0xfe, 0x8f, 0xff, 0xff, 0xff, 0x01, 0x69, 0x6c, 0xfa, 0x3a, 0x42, 0xf9, 0x03, 0x3a, 0x42, 0xf9,
+	0x3a, 0x42, 0xf9, 0x8d, 0x90, 0xfa, 0xfa, 0xfa, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf1,
+	0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff,
+	0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff,
+	0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1, 0xfe, 0x8d,
+	0xff, 0xff, 0xff, 0x03, 0xfa, 0xfa, 0xff, 0x8c, 0x8f, 0xfa, 0x3a, 0x42, 0xf9, 0x3a, 0x42, 0xf9,
+	0x80, 0x3a, 0x42, 0xf9, 0x01, 0x70, 0x74, 0xfa, 0xe3, 0xe4, 0xfe, 0x8c, 0xff, 0xff, 0xff, 0x01,
+	0xf1, 0xf1, 0xfe, 0x55, 0x5a, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x55, 0x5a, 0xf9, 0xf1, 0xf1,
+	0xfe, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xe3, 0xe3, 0xfe, 0x70, 0x74, 0xfa, 0x80, 0x3a, 0x42, 0xf9,
+	0x82, 0x3a, 0x42, 0xf9, 0x04, 0x8f, 0x91, 0xfa, 0xd9, 0xd9, 0xfd, 0xee, 0xee, 0xfe, 0xf3, 0xf3,
+	0xfe, 0xf5, 0xf5, 0xfe, 0x87, 0xf6, 0xf6, 0xfe, 0x01, 0xe8, 0xe8, 0xfe, 0x53, 0x59, 0xf9, 0x8a,
+	0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7,
+	0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a,
+	0x3a, 0x42, 0xf9, 0x01, 0x53, 0x59, 0xf9, 0xe8, 0xe8, 0xfe, 0x87, 0xf6, 0xf6, 0xfe, 0x04, 0xf5,
+	0xf5, 0xfe, 0xf3, 0xf3, 0xfe, 0xed, 0xee, 0xfe, 0xd9, 0xd9, 0xfd, 0x8e, 0x90, 0xfa, 0x82, 0x3a,
+	0x42, 0xf9, 0x84, 0x3a, 0x42, 0xf9, 0x01, 0x48, 0x4e, 0xf9, 0x5d, 0x62, 0xf9, 0x88, 0x64, 0x68,
+	0xfa, 0x01, 0x60, 0x64, 0xf9, 0x3d, 0x44, 0xf9, 0x8a, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd,
+	0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe,
+	0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0x8a, 0x3a, 0x42, 0xf9, 0x01, 0x3d, 0x44, 0xf9,
+	0x60, 0x64, 0xf9, 0x88, 0x64, 0x68, 0xfa, 0x01, 0x5d, 0x62, 0xf9, 0x48, 0x4e, 0xf9, 0x84, 0x3a,
+	0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea,
+	0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb,
+	0xdc, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xdb,
+	0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea,
+	0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a,
+	0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a,
+	0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xdc, 0xfd, 0xa0, 0x3a,
+	0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xdb, 0xdc, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xea,
+	0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xdb,
+	0xdc, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xd9, 0xd9, 0xfd, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xea, 0xea, 0xfe, 0xd7, 0x3a, 0x42, 0xf9, 0x00, 0xea, 0xea, 0xfe, 0x8f, 0xff,
+	0xff, 0xff, 0x00, 0xd6, 0xd7, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xd5,
+	0xd5, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xf2, 0xfe, 0xa1, 0xa2, 0xfb, 0x98, 0xa1, 0xa3,
+	0xfb, 0x03, 0x9f, 0xa1, 0xfb, 0x90, 0x92, 0xfb, 0x79, 0x7c, 0xfa, 0x5f, 0x63, 0xf9, 0x97, 0x3a,
+	0x42, 0xf9, 0x03, 0x5f, 0x63, 0xf9, 0x7a, 0x7d, 0xfa, 0x91, 0x93, 0xfb, 0xa0, 0xa1, 0xfb, 0x98,
+	0xa1, 0xa3, 0xfb, 0x01, 0xa1, 0xa2, 0xfb, 0xf1, 0xf2, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xd5,
+	0xd5, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xd0, 0xd1, 0xfd, 0xae, 0xff,
+	0xff, 0xff, 0x03, 0xfd, 0xfd, 0xff, 0xf4, 0xf4, 0xfe, 0xda, 0xdb, 0xfd, 0x69, 0x6c, 0xfa, 0x93,
+	0x3a, 0x42, 0xf9, 0x03, 0x6a, 0x6e, 0xfa, 0xdb, 0xdb, 0xfd, 0xf4, 0xf4, 0xfe, 0xfd, 0xfd, 0xff,
+	0xae, 0xff, 0xff, 0xff, 0x00, 0xcf, 0xd0, 0xfd, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9,
+	0x00, 0xc5, 0xc6, 0xfc, 0xb2, 0xff, 0xff, 0xff, 0x00, 0xa6, 0xa7, 0xfb, 0x91, 0x3a, 0x42, 0xf9,
+	0x00, 0xa6, 0xa7, 0xfb, 0xb2, 0xff, 0xff, 0xff, 0x00, 0xc4, 0xc5, 0xfc, 0xa0, 0x3a, 0x42, 0xf9,
+	0xa0, 0x3a, 0x42, 0xf9, 0x00, 0xb2, 0xb4, 0xfc, 0xb3, 0xff, 0xff, 0xff, 0x00, 0xc4, 0xc5, 0xfc,
+	0x8f, 0x3a, 0x42, 0xf9, 0x00, 0xc5, 0xc6, 0xfc, 0xb3, 0xff, 0xff, 0xff, 0x00, 0xb2, 0xb3, 0xfc,
+	0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a, 0x42, 0xf9, 0x00, 0x92, 0x94, 0xfb, 0xb3, 0xff, 0xff, 0xff,
+	0x01, 0xfd, 0xfd, 0xff, 0x82, 0x84, 0xfa, 0x8d, 0x3a, 0x42, 0xf9, 0x01, 0x83, 0x85, 0xfa, 0xfd,
+	0xfd, 0xff, 0xb3, 0xff, 0xff, 0xff, 0x00, 0x91, 0x93, 0xfb, 0xa0, 0x3a, 0x42, 0xf9, 0xa0, 0x3a,
+	0x42, 0xf9, 0x00, 0x41, 0x48, 0xf9, 0xb4, 0xff, 0xff, 0xff, 0x00, 0xe3, 0xe4, 0xfe, 0x8d, 0x3a,
+	0x42, 0xf9, 0x00, 0xe4, 0xe4, 0xfe, 0xb4, 0xff, 0xff, 0xff, 0x00, 0x41, 0x48, 0xf9, 0xa0, 0x3a,
+	0x42, 0xf9, 0xa1, 0x3a, 0x42, 0xf9, 0x00, 0xec, 0xed, 0xfe, 0xb4, 0xff, 0xff, 0xff, 0x00, 0x69,
+	0x6c, 0xfa, 0x8b, 0x3a, 0x42, 0xf9, 0x00, 0x69, 0x6c, 0xfa, 0xb4, 0xff, 0xff, 0xff, 0x00, 0xec,
+	0xed, 0xfe, 0xa1, 0x3a, 0x42, 0xf9, 0xa1, 0x3a, 0x42, 0xf9, 0x00, 0xad, 0xae, 0xfb, 0xb4, 0xff,
+	0xff, 0xff, 0x00, 0xb8, 0xb9, 0xfc, 0x8b, 0x3a, 0x42, 0xf9, 0x00, 0xb8, 0xb9, 0xfc, 0xb4, 0xff,
+	0xff, 0xff, 0x00, 0xad, 0xae, 0xfb, 0xa1, 0x3a, 0x42, 0xf9, 0xa1, 0x3a, 0x42, 0xf9, 0x01, 0x6a,
+	0x6e, 0xfa, 0xf9, 0xf9, 0xff, 0xb3, 0xff, 0xff, 0xff, 0x00, 0xd9, 0xd9, 0xfd, 0x8b, 0x3a, 0x42,
+	0xf9, 0x00, 0xd9, 0xd9, 0xfd, 0xb3, 0xff, 0xff, 0xff, 0x01, 0xf9, 0xf9, 0xff, 0x6a, 0x6e, 0xfa,
+	0xa1, 0x3a, 0x42, 0xf9, 0xa2, 0x3a, 0x42, 0xf9, 0x00, 0xd4, 0xd5, 0xfd, 0xb3, 0xff, 0xff, 0xff,
+	0x00, 0xe3, 0xe3, 0xfe, 0x8b, 0x3a, 0x42, 0xf9, 0x00, 0xe3, 0xe3, 0xfe, 0xb3, 0xff, 0xff, 0xff,
+	0x00, 0xd4, 0xd5, 0xfd, 0xa2, 0x3a, 0x42, 0xf9, 0xa2, 0x3a, 0x42, 0xf9, 0x01, 0x3d, 0x44, 0xf9,
+	0xfa, 0xfa, 0xff, 0xb2, 0xff, 0xff, 0xff, 0x00, 0xe3, 0xe4, 0xfe, 0x8b, 0x3a, 0x42, 0xf9, 0x00,
+	0xe3, 0xe4, 0xfe, 0xb2, 0xff, 0xff, 0xff, 0x01, 0xfa, 0xfa, 0xff, 0x3d, 0x44, 0xf9, 0xa2, 0x3a,
+	0x42, 0xf9, 0xa3, 0x3a, 0x42, 0xf9, 0x01, 0x8e, 0x90, 0xfa, 0xfe, 0xfe, 0xff, 0xb1, 0xff, 0xff,
+	0xff, 0x00, 0xdf, 0xdf, 0xfd, 0x8b, 0x3a, 0x42, 0xf9, 0x00, 0xdf, 0xdf, 0xfd, 0xb1, 0xff, 0xff,
+	0xff, 0x01, 0xfe, 0xfe, 0xff, 0x8d, 0x90, 0xfa, 0xa3, 0x3a, 0x42, 0xf9, 0xa4, 0x3a, 0x42, 0xf9,
+	0x00, 0xc9, 0xca, 0xfc, 0xb1, 0xff, 0xff, 0xff, 0x00, 0xc7, 0xc8, 0xfc, 0x8b, 0x3a, 0x42, 0xf9,
+	0x00, 0xc7, 0xc8, 0xfc, 0xb1, 0xff, 0xff, 0xff, 0x00, 0xc8, 0xc9, 0xfc, 0xa4, 0x3a, 0x42, 0xf9,
+	0xa5, 0x3a, 0x42, 0xf9, 0x00, 0xc8, 0xc9, 0xfc, 0xb0, 0xff, 0xff, 0xff, 0x00, 0x91, 0x93, 0xfb,
+	0x8b, 0x3a, 0x42, 0xf9, 0x00, 0x91, 0x93, 0xfb, 0xb0, 0xff, 0xff, 0xff, 0x00, 0xc8, 0xc9, 0xfc,
+	0xa5, 0x3a, 0x42, 0xf9, 0xa5, 0x3a, 0x42, 0xf9, 0x01, 0x3f, 0x46, 0xf9, 0xdb, 0xdb, 0xfd, 0xae,
+	0xff, 0xff, 0xff, 0x00, 0xf9, 0xfa, 0xff, 0x8d, 0x3a, 0x42, 0xf9, 0x00, 0xfa, 0xfa, 0xff, 0xae,
+	0xff, 0xff, 0xff, 0x01, 0xda, 0xdb, 0xfd, 0x3f, 0x46, 0xf9, 0xa5, 0x3a, 0x42, 0xf9, 0xa6, 0x3a,
+	0x42, 0xf9, 0x01, 0x3f, 0x46, 0xf9, 0xbd, 0xbe, 0xfc, 0xad, 0xff, 0xff, 0xff, 0x00, 0xa5, 0xa7,
+	0xfb, 0x8d, 0x3a, 0x42, 0xf9, 0x00, 0xa6, 0xa7, 0xfb, 0xad, 0xff, 0xff, 0xff, 0x01, 0xbd, 0xbe,
+	0xfc, 0x3d, 0x44, 0xf9, 0xa6, 0x3a, 0x42, 0xf9, 0xa8, 0x3a, 0x42, 0xf9, 0x01, 0xac, 0xae, 0xfb,
+	0xf7, 0xf7, 0xff, 0xaa, 0xff, 0xff, 0xff, 0x01, 0xe5, 0xe6, 0xfe, 0x4a, 0x50, 0xf9, 0x8d, 0x3a,
+	0x42, 0xf9, 0x01, 0x4a, 0x50, 0xf9, 0xe6, 0xe6, 0xfe, 0xaa, 0xff, 0xff, 0xff, 0x01, 0xf7, 0xf7,
+	0xff, 0xac, 0xad, 0xfb, 0xa8, 0x3a, 0x42, 0xf9, 0xa9, 0x3a, 0x42, 0xf9, 0x01, 0x62, 0x66, 0xfa,
+	0xc2, 0xc3, 0xfc, 0xa8, 0xff, 0xff, 0xff, 0x01, 0xe1, 0xe2, 0xfd, 0x4e, 0x54, 0xf9, 0x8f, 0x3a,
+	0x42, 0xf9, 0x01, 0x50, 0x55, 0xf9, 0xe1, 0xe2, 0xfd, 0xa8, 0xff, 0xff, 0xff, 0x01, 0xc2, 0xc3,
+	0xfc, 0x62, 0x66, 0xfa, 0xa9, 0x3a, 0x42, 0xf9, 0xab, 0x3a, 0x42, 0xf9, 0x03, 0x4a, 0x50, 0xf9,
+	0xc5, 0xc6, 0xfc, 0xee, 0xef, 0xfe, 0xf8, 0xf8, 0xff, 0xa2, 0xff, 0xff, 0xff, 0x03, 0xf5, 0xf5,
+	0xfe, 0xc5, 0xc6, 0xfc, 0x3a, 0x42, 0xf9, 0x3d, 0x44, 0xf9, 0x8f, 0x3a, 0x42, 0xf9, 0x03, 0x3d,
+	0x44, 0xf9, 0x3a, 0x42, 0xf9, 0xc5, 0xc6, 0xfc, 0xf5, 0xf5, 0xfe, 0xa2, 0xff, 0xff, 0xff, 0x03,
+	0xf8, 0xf8, 0xff, 0xee, 0xef, 0xfe, 0xc5, 0xc6, 0xfc, 0x4a, 0x50, 0xf9, 0xab, 0x3a, 0x42, 0xf9,
+	0xad, 0x3a, 0x42, 0xf9, 0x07, 0x46, 0x4c, 0xf9, 0x6c, 0x70, 0xfa, 0x84, 0x86, 0xfa, 0xa7, 0xa9,
+	0xfb, 0xc2, 0xc3, 0xfc, 0xd3, 0xd4, 0xfd, 0xdd, 0xdd, 0xfd, 0xe3, 0xe4, 0xfe, 0x98, 0xe4, 0xe4,
+	0xfe, 0x04, 0xe3, 0xe4, 0xfe, 0xd9, 0xd9, 0xfd, 0xbe, 0xbf, 0xfc, 0x8b, 0x8e, 0xfa, 0x5f, 0x63,
+	0xf9, 0x95, 0x3a, 0x42, 0xf9, 0x04, 0x5f, 0x63, 0xf9, 0x8b, 0x8e, 0xfa, 0xbe, 0xbf, 0xfc, 0xd9,
+	0xd9, 0xfd, 0xe3, 0xe4, 0xfe, 0x98, 0xe4, 0xe4, 0xfe, 0x07, 0xe3, 0xe4, 0xfe, 0xdd, 0xdd, 0xfd,
+	0xd3, 0xd4, 0xfd, 0xc2, 0xc3, 0xfc, 0xa7, 0xa9, 0xfb, 0x84, 0x86, 0xfa, 0x6c, 0x70, 0xfa, 0x46,
+	0x4c, 0xf9, 0xad, 0x3a, 0x42, 0xf9
+};
+
+
+static const asset_t logo24 = {
+	.width = 200,
+	.height = 150,
+	.depth = 3,
+	.size = sizeof(logo24_data),
+	.crc = 0x1364d0b8,
+	.data = logo24_data
 };
 
 
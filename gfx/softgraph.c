@@ -0,0 +1,898 @@
+/*
+ * Phoenix-RTOS
+ *
+ * Memory-backed software graphics target
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "softgraph.h"
+
+
+#define SOFTGRAPH_TILEMIN (32 * 1024) /* Smaller operations aren't split into tiles */
+
+
+typedef enum { jobFill, jobMoveRows, jobCopy } softgraph_op_t;
+
+
+/* Operation split into tiles */
+typedef struct {
+	softgraph_op_t op;
+	unsigned int x, y, dx, dy;
+	int mx, my;
+	uint32_t pattern;
+	const unsigned char *src;
+	unsigned char *dst;
+	size_t srcspan, dstspan;
+	unsigned int size;   /* Split dimension size (rows or columns) */
+	unsigned int ntiles; /* Number of tiles */
+	unsigned int next;   /* Next tile to process */
+} softgraph_job_t;
+
+
+struct softgraph_pool {
+	pthread_mutex_t lock;
+	pthread_cond_t start;  /* New job or stop request */
+	pthread_cond_t finish; /* All workers finished job */
+	unsigned int gen;      /* Job generation */
+	unsigned int active;   /* Workers processing current job */
+	int stop;
+	softgraph_job_t job;
+	unsigned int nthreads;
+	pthread_t threads[];
+};
+
+
+/* Generic 16-byte vector, compiled to SIMD registers where available (SSE, NEON) */
+typedef uint32_t softgraph_vec_t __attribute__((vector_size(16)));
+
+
+#define SG_VECSZ sizeof(softgraph_vec_t)
+
+
+/* Replicates color into 32-bit fill pattern */
+static uint32_t softgraph_pattern(const softgraph_t *sg, unsigned int color)
+{
+	switch (sg->depth) {
+		case 1:
+			return (color & 0xff) * 0x01010101U;
+
+		case 2:
+			return (color & 0xffff) * 0x00010001U;
+
+		default:
+			return color;
+	}
+}
+
+
+/* Fills n bytes span starting at pixel boundary */
+static void softgraph_span(unsigned char *p, size_t n, uint32_t pattern, unsigned char depth)
+{
+	softgraph_vec_t v = { pattern, pattern, pattern, pattern };
+	unsigned char *end = p + n;
+
+	/* Align to vector size pixel by pixel, pattern period (4 bytes) is multiple of depth */
+	while (((uintptr_t)p & (SG_VECSZ - 1)) && (p < end)) {
+		memcpy(p, &pattern, depth);
+		p += depth;
+	}
+
+	/* Pattern phase is preserved only if we've reached vector boundary */
+	if (!((uintptr_t)p & (SG_VECSZ - 1))) {
+		for (; p + 4 * SG_VECSZ <= end; p += 4 * SG_VECSZ) {
+			((softgraph_vec_t *)p)[0] = v;
+			((softgraph_vec_t *)p)[1] = v;
+			((softgraph_vec_t *)p)[2] = v;
+			((softgraph_vec_t *)p)[3] = v;
+		}
+
+		for (; p + SG_VECSZ <= end; p += SG_VECSZ)
+			*(softgraph_vec_t *)p = v;
+	}
+
+	for (; p < end; p += depth)
+		memcpy(p, &pattern, depth);
+}
+
+
+/* Copies n bytes between non-overlapping spans */
+static void softgraph_blit(unsigned char *dst, const unsigned char *src, size_t n)
+{
+	softgraph_vec_t v0, v1, v2, v3;
+
+	/* Unaligned vector loads and stores, memcpy() is lowered to single instructions */
+	for (; n >= 4 * SG_VECSZ; n -= 4 * SG_VECSZ, src += 4 * SG_VECSZ, dst += 4 * SG_VECSZ) {
+		memcpy(&v0, src, SG_VECSZ);
+		memcpy(&v1, src + SG_VECSZ, SG_VECSZ);
+		memcpy(&v2, src + 2 * SG_VECSZ, SG_VECSZ);
+		memcpy(&v3, src + 3 * SG_VECSZ, SG_VECSZ);
+		memcpy(dst, &v0, SG_VECSZ);
+		memcpy(dst + SG_VECSZ, &v1, SG_VECSZ);
+		memcpy(dst + 2 * SG_VECSZ, &v2, SG_VECSZ);
+		memcpy(dst + 3 * SG_VECSZ, &v3, SG_VECSZ);
+	}
+
+	memcpy(dst, src, n);
+}
+
+
+/*
+ * Damage tracking
+ */
+
+
+static inline int softgraph_rectEmpty(const softgraph_rect_t *r)
+{
+	return (r->dx == 0) || (r->dy == 0);
+}
+
+
+/* Extends a to bounding box of a and b */
+static void softgraph_rectUnion(softgraph_rect_t *a, const softgraph_rect_t *b)
+{
+	unsigned int x, y;
+
+	if (softgraph_rectEmpty(b))
+		return;
+
+	if (softgraph_rectEmpty(a)) {
+		*a = *b;
+		return;
+	}
+
+	x = (a->x + a->dx > b->x + b->dx) ? a->x + a->dx : b->x + b->dx;
+	y = (a->y + a->dy > b->y + b->dy) ? a->y + a->dy : b->y + b->dy;
+	a->x = (a->x < b->x) ? a->x : b->x;
+	a->y = (a->y < b->y) ? a->y : b->y;
+	a->dx = x - a->x;
+	a->dy = y - a->y;
+}
+
+
+/* Returns 0 if a and b don't intersect */
+static int softgraph_rectIntersect(const softgraph_rect_t *a, const softgraph_rect_t *b, softgraph_rect_t *r)
+{
+	unsigned int x0 = (a->x > b->x) ? a->x : b->x, y0 = (a->y > b->y) ? a->y : b->y;
+	unsigned int x1 = (a->x + a->dx < b->x + b->dx) ? a->x + a->dx : b->x + b->dx;
+	unsigned int y1 = (a->y + a->dy < b->y + b->dy) ? a->y + a->dy : b->y + b->dy;
+
+	if ((x0 >= x1) || (y0 >= y1))
+		return 0;
+
+	r->x = x0;
+	r->y = y0;
+	r->dx = x1 - x0;
+	r->dy = y1 - y0;
+
+	return 1;
+}
+
+
+/* Returns 1 if a lies inside b */
+static int softgraph_rectInside(const softgraph_rect_t *a, const softgraph_rect_t *b)
+{
+	return (a->x >= b->x) && (a->y >= b->y) && (a->x + a->dx <= b->x + b->dx) && (a->y + a->dy <= b->y + b->dy);
+}
+
+
+/* Splits a without b into up to 4 rectangles, returns their number */
+static unsigned int softgraph_rectSubtract(const softgraph_rect_t *a, const softgraph_rect_t *b, softgraph_rect_t r[4])
+{
+	softgraph_rect_t i;
+	unsigned int n = 0;
+
+	if (!softgraph_rectIntersect(a, b, &i)) {
+		r[0] = *a;
+		return 1;
+	}
+
+	/* Full width top and bottom parts, intersection height left and right parts */
+	if (i.y > a->y)
+		r[n++] = (softgraph_rect_t) { a->x, a->y, a->dx, i.y - a->y };
+	if (i.y + i.dy < a->y + a->dy)
+		r[n++] = (softgraph_rect_t) { a->x, i.y + i.dy, a->dx, a->y + a->dy - i.y - i.dy };
+	if (i.x > a->x)
+		r[n++] = (softgraph_rect_t) { a->x, i.y, i.x - a->x, i.dy };
+	if (i.x + i.dx < a->x + a->dx)
+		r[n++] = (softgraph_rect_t) { i.x + i.dx, i.y, a->x + a->dx - i.x - i.dx, i.dy };
+
+	return n;
+}
+
+
+/* Adds damaged rectangle */
+static void softgraph_damage(softgraph_t *sg, const softgraph_rect_t *r)
+{
+	unsigned int i;
+
+	if (!sg->track || softgraph_rectEmpty(r))
+		return;
+
+	for (i = 0; i < sg->ndamage;) {
+		if (softgraph_rectInside(r, &sg->damage[i]))
+			return;
+
+		if (softgraph_rectInside(&sg->damage[i], r))
+			sg->damage[i] = sg->damage[--sg->ndamage];
+		else
+			i++;
+	}
+
+	/* Out of slots - collapse all rectangles into their bounding box */
+	if (sg->ndamage == SOFTGRAPH_DAMAGE) {
+		for (i = 1; i < sg->ndamage; i++)
+			softgraph_rectUnion(&sg->damage[0], &sg->damage[i]);
+		softgraph_rectUnion(&sg->damage[0], r);
+		sg->ndamage = 1;
+		return;
+	}
+
+	sg->damage[sg->ndamage++] = *r;
+}
+
+
+/* Marks area as changed since last commit and damaged */
+static void softgraph_changed(softgraph_t *sg, unsigned int x, unsigned int y, unsigned int dx, unsigned int dy)
+{
+	softgraph_rect_t r = { x, y, dx, dy };
+
+	softgraph_rectUnion(&sg->dirty, &r);
+	softgraph_damage(sg, &r);
+}
+
+
+/* Fills rectangle without bounds checking */
+static void softgraph_fill(softgraph_t *sg, unsigned int x, unsigned int y, unsigned int dx, unsigned int dy, uint32_t pattern)
+{
+	size_t span = (size_t)sg->depth * sg->width;
+	unsigned char *p = (unsigned char *)sg->data + y * span + (size_t)x * sg->depth;
+
+	/* Full width rectangle is one continuous span */
+	if (dx == sg->width) {
+		softgraph_span(p, dy * span, pattern, sg->depth);
+		return;
+	}
+
+	for (; dy--; p += span)
+		softgraph_span(p, (size_t)dx * sg->depth, pattern, sg->depth);
+}
+
+
+/* Moves rectangle without bounds checking */
+static void softgraph_moveRect(softgraph_t *sg, unsigned int x, unsigned int y, unsigned int dx, unsigned int dy, int mx, int my)
+{
+	size_t span = (size_t)sg->depth * sg->width, n = (size_t)sg->depth * dx;
+	unsigned char *src, *dst;
+	unsigned int i;
+
+	src = (unsigned char *)sg->data + y * span + (size_t)x * sg->depth;
+	dst = src + (ptrdiff_t)my * (ptrdiff_t)span + (ptrdiff_t)mx * sg->depth;
+
+	/* Rows overlap only with horizontal moves */
+	if (my == 0) {
+		for (i = 0; i < dy; i++)
+			memmove(dst + i * span, src + i * span, n);
+	}
+	/* Full width rows - single continuous move */
+	else if ((dx == sg->width) && (mx == 0)) {
+		memmove(dst, src, dy * span);
+	}
+	/* Moving down - start from the bottom row not to overwrite source */
+	else if (my > 0) {
+		for (i = dy; i--;)
+			softgraph_blit(dst + i * span, src + i * span, n);
+	}
+	else {
+		for (i = 0; i < dy; i++)
+			softgraph_blit(dst + i * span, src + i * span, n);
+	}
+}
+
+
+/*
+ * Tiled operations
+ */
+
+
+static void softgraph_tile(softgraph_t *sg, const softgraph_job_t *job, unsigned int tile)
+{
+	unsigned int a = tile * job->size / job->ntiles, b = (tile + 1) * job->size / job->ntiles, i;
+
+	switch (job->op) {
+		case jobFill:
+			softgraph_fill(sg, job->x, job->y + a, job->dx, b - a, job->pattern);
+			break;
+
+		case jobMoveRows:
+			softgraph_moveRect(sg, job->x, job->y + a, job->dx, b - a, job->mx, job->my);
+			break;
+
+		case jobCopy:
+			for (i = a; i < b; i++)
+				softgraph_blit(job->dst + (size_t)i * job->dstspan, job->src + (size_t)i * job->srcspan, (size_t)sg->depth * job->dx);
+			break;
+	}
+}
+
+
+/* Processes tiles of current job until there are no more left */
+static void softgraph_tiles(softgraph_t *sg, softgraph_job_t *job)
+{
+	unsigned int tile;
+
+	while ((tile = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED)) < job->ntiles)
+		softgraph_tile(sg, job, tile);
+}
+
+
+static void *softgraph_worker(void *arg)
+{
+	softgraph_t *sg = arg;
+	softgraph_pool_t *pool = sg->pool;
+	unsigned int gen = 0;
+
+	pthread_mutex_lock(&pool->lock);
+	for (;;) {
+		while (!pool->stop && (pool->gen == gen))
+			pthread_cond_wait(&pool->start, &pool->lock);
+
+		if (pool->stop)
+			break;
+
+		gen = pool->gen;
+		pthread_mutex_unlock(&pool->lock);
+
+		softgraph_tiles(sg, &pool->job);
+
+		pthread_mutex_lock(&pool->lock);
+		if (--pool->active == 0)
+			pthread_cond_signal(&pool->finish);
+	}
+	pthread_mutex_unlock(&pool->lock);
+
+	return NULL;
+}
+
+
+/* Runs job split into tiles of size units on all threads, returns -1 if job isn't worth splitting */
+static int softgraph_run(softgraph_t *sg, const softgraph_job_t *job, unsigned int size, size_t bytes)
+{
+	softgraph_pool_t *pool = sg->pool;
+
+	if ((pool == NULL) || (bytes < SOFTGRAPH_TILEMIN) || (size < 2))
+		return -1;
+
+	pthread_mutex_lock(&pool->lock);
+	pool->job = *job;
+	pool->job.size = size;
+	pool->job.ntiles = (size < 4 * (pool->nthreads + 1)) ? size : 4 * (pool->nthreads + 1);
+	pool->job.next = 0;
+	pool->active = pool->nthreads;
+	pool->gen++;
+	pthread_cond_broadcast(&pool->start);
+	pthread_mutex_unlock(&pool->lock);
+
+	/* Calling thread works too */
+	softgraph_tiles(sg, &pool->job);
+
+	pthread_mutex_lock(&pool->lock);
+	while (pool->active)
+		pthread_cond_wait(&pool->finish, &pool->lock);
+	pthread_mutex_unlock(&pool->lock);
+
+	return 0;
+}
+
+
+/* Fills rectangle without bounds checking, splits large fills into tiles */
+static void softgraph_fillTiled(softgraph_t *sg, unsigned int x, unsigned int y, unsigned int dx, unsigned int dy, uint32_t pattern)
+{
+	softgraph_job_t job = { .op = jobFill, .x = x, .y = y, .dx = dx, .dy = dy, .pattern = pattern };
+
+	if (softgraph_run(sg, &job, dy, (size_t)sg->depth * dx * dy) < 0)
+		softgraph_fill(sg, x, y, dx, dy, pattern);
+}
+
+
+/* Copies bitmap without bounds checking, splits large copies into tiles */
+static void softgraph_copyTiled(softgraph_t *sg, const unsigned char *src, unsigned char *dst, unsigned int dx, unsigned int dy, size_t srcspan, size_t dstspan)
+{
+	softgraph_job_t job = { .op = jobCopy, .dx = dx, .dy = dy, .src = src, .dst = dst, .srcspan = srcspan, .dstspan = dstspan };
+	size_t n = (size_t)sg->depth * dx;
+	unsigned int i;
+
+	if (softgraph_run(sg, &job, dy, n * dy) == 0)
+		return;
+
+	/* Continuous bitmap - single copy */
+	if ((srcspan == n) && (dstspan == n)) {
+		softgraph_blit(dst, src, dy * n);
+		return;
+	}
+
+	for (i = 0; i < dy; i++)
+		softgraph_blit(dst + i * dstspan, src + i * srcspan, n);
+}
+
+
+int softgraph_rect(softgraph_t *sg, unsigned int x, unsigned int y, unsigned int dx, unsigned int dy, unsigned int color)
+{
+	if ((x + dx > sg->width) || (y + dy > sg->height) || (x + dx < x) || (y + dy < y))
+		return -EINVAL;
+
+	softgraph_fillTiled(sg, x, y, dx, dy, softgraph_pattern(sg, color));
+
+	/* Full screen fill sets new background */
+	if (sg->track && (dx == sg->width) && (dy == sg->height)) {
+		sg->bg = softgraph_pattern(sg, color);
+		sg->ndamage = 0;
+		sg->dirty = (softgraph_rect_t) { 0, 0, dx, dy };
+		return 0;
+	}
+	softgraph_changed(sg, x, y, dx, dy);
+
+	return 0;
+}
+
+
+int softgraph_line(softgraph_t *sg, unsigned int x, unsigned int y, int dx, int dy, unsigned int stroke, unsigned int color)
+{
+	uint32_t pattern = softgraph_pattern(sg, color);
+	int sx = (dx < 0) ? -1 : 1, sy = (dy < 0) ? -1 : 1;
+	int ax = abs(dx), ay = abs(dy), err;
+	unsigned int i;
+
+	if ((stroke == 0) || ((dx < 0) && (x < (unsigned int)ax)) || ((dy < 0) && (y < (unsigned int)ay)))
+		return -EINVAL;
+
+	if ((x + ((dx > 0) ? dx : 0) + stroke > sg->width) || (y + ((dy > 0) ? dy : 0) + stroke > sg->height))
+		return -EINVAL;
+
+	softgraph_changed(sg, (dx < 0) ? x - ax : x, (dy < 0) ? y - ay : y, ax + stroke, ay + stroke);
+
+	/* Axis aligned lines are single rectangles */
+	if (dy == 0) {
+		softgraph_fill(sg, (dx < 0) ? x - ax : x, y, ax + stroke, stroke, pattern);
+		return 0;
+	}
+
+	if (dx == 0) {
+		softgraph_fill(sg, x, (dy < 0) ? y - ay : y, stroke, ay + stroke, pattern);
+		return 0;
+	}
+
+	/* Bresenham, stroke x stroke square at every point */
+	if (ax >= ay) {
+		for (i = 0, err = ax / 2; i <= (unsigned int)ax; i++, x += sx) {
+			softgraph_fill(sg, x, y, stroke, stroke, pattern);
+			if ((err -= ay) < 0) {
+				err += ax;
+				y += sy;
+			}
+		}
+	}
+	else {
+		for (i = 0, err = ay / 2; i <= (unsigned int)ay; i++, y += sy) {
+			softgraph_fill(sg, x, y, stroke, stroke, pattern);
+			if ((err -= ax) < 0) {
+				err += ay;
+				x += sx;
+			}
+		}
+	}
+
+	return 0;
+}
+
+
+/* Moves rectangle without bounds checking, splits large moves into tiles */
+static void softgraph_moveRaw(softgraph_t *sg, unsigned int x, unsigned int y, unsigned int dx, unsigned int dy, int mx, int my)
+{
+	softgraph_job_t job = { .op = jobMoveRows, .x = x, .dx = dx, .mx = mx, .my = my };
+	size_t n = (size_t)sg->depth * dx;
+	unsigned int h, i;
+
+	sg->moved += n * dy;
+
+	/* Full width vertical moves are single continuous memmove */
+	if ((mx == 0) && (dx == sg->width)) {
+		softgraph_moveRect(sg, x, y, dx, dy, mx, my);
+		return;
+	}
+
+	/*
+	 * Tiles have to be independent - moves are split into bands of at most |my| rows, which don't overlap
+	 * their destinations, processed one after another starting from the band furthest in moving direction
+	 */
+	h = (my == 0) ? dy : (unsigned int)((my < 0) ? -my : my);
+	if (h > dy)
+		h = dy;
+
+	if ((sg->pool == NULL) || (n * h < SOFTGRAPH_BANDMIN)) {
+		softgraph_moveRect(sg, x, y, dx, dy, mx, my);
+		return;
+	}
+
+	for (i = 0; i < dy; i += job.dy) {
+		job.dy = (dy - i < h) ? dy - i : h;
+		job.y = (my > 0) ? y + dy - i - job.dy : y + i;
+		if (softgraph_run(sg, &job, job.dy, n * job.dy) < 0)
+			softgraph_moveRect(sg, x, job.y, dx, job.dy, mx, my);
+	}
+}
+
+
+/* Moves only damaged part of rectangle and clears stale damaged content left in destination */
+static void softgraph_moveDamaged(softgraph_t *sg, unsigned int x, unsigned int y, unsigned int dx, unsigned int dy, int mx, int my)
+{
+	softgraph_rect_t r = { x, y, dx, dy }, rd = { x + mx, y + my, dx, dy }, b = { 0 }, bd = { 0 }, i, p[4];
+	softgraph_rect_t damage[SOFTGRAPH_DAMAGE];
+	unsigned int k, j, n, ndamage = sg->ndamage;
+
+	/* Source pixels outside damaged bounding box have background color */
+	for (k = 0; k < ndamage; k++) {
+		if (softgraph_rectIntersect(&sg->damage[k], &r, &i))
+			softgraph_rectUnion(&b, &i);
+	}
+
+	if (!softgraph_rectEmpty(&b)) {
+		softgraph_moveRaw(sg, b.x, b.y, b.dx, b.dy, mx, my);
+		bd = (softgraph_rect_t) { b.x + mx, b.y + my, b.dx, b.dy };
+		softgraph_rectUnion(&sg->dirty, &bd);
+	}
+
+	/* Rest of destination becomes background, only damaged pixels need clearing */
+	memcpy(damage, sg->damage, ndamage * sizeof(*damage));
+	n = softgraph_rectSubtract(&rd, &bd, p);
+	for (j = 0; j < n; j++) {
+		for (k = 0; k < ndamage; k++) {
+			if (softgraph_rectIntersect(&damage[k], &p[j], &i)) {
+				softgraph_fillTiled(sg, i.x, i.y, i.dx, i.dy, sg->bg);
+				sg->moved += (size_t)sg->depth * i.dx * i.dy;
+				softgraph_rectUnion(&sg->dirty, &i);
+			}
+		}
+	}
+
+	/* Damaged areas outside destination are unchanged */
+	sg->ndamage = 0;
+	for (k = 0; k < ndamage; k++) {
+		n = softgraph_rectSubtract(&damage[k], &rd, p);
+		for (j = 0; j < n; j++)
+			softgraph_damage(sg, &p[j]);
+	}
+	softgraph_damage(sg, &bd);
+}
+
+
+int softgraph_move(softgraph_t *sg, unsigned int x, unsigned int y, unsigned int dx, unsigned int dy, int mx, int my)
+{
+	if ((x + dx > sg->width) || (y + dy > sg->height) || (x + dx < x) || (y + dy < y))
+		return -EINVAL;
+
+	if (((mx < 0) && (x < (unsigned int)-mx)) || ((my < 0) && (y < (unsigned int)-my)))
+		return -EINVAL;
+
+	if (((mx > 0) && (x + dx + mx > sg->width)) || ((my > 0) && (y + dy + my > sg->height)))
+		return -EINVAL;
+
+	if ((dx == 0) || (dy == 0) || ((mx == 0) && (my == 0)))
+		return 0;
+
+	if (sg->track) {
+		softgraph_moveDamaged(sg, x, y, dx, dy, mx, my);
+	}
+	else {
+		softgraph_moveRaw(sg, x, y, dx, dy, mx, my);
+		softgraph_changed(sg, x + mx, y + my, dx, dy);
+	}
+
+	return 0;
+}
+
+
+int softgraph_copy(softgraph_t *sg, const void *src, void *dst, unsigned int dx, unsigned int dy, unsigned int srcspan, unsigned int dstspan)
+{
+	unsigned char *end = (unsigned char *)sg->data + (size_t)sg->depth * sg->width * sg->height;
+	size_t n = (size_t)sg->depth * dx, span = (size_t)sg->depth * sg->width, offs;
+	unsigned int x, y;
+
+	if ((dx == 0) || (dy == 0))
+		return 0;
+
+	if (((unsigned char *)dst < (unsigned char *)sg->data) || ((size_t)(end - (unsigned char *)dst) < (size_t)(dy - 1) * dstspan + n) || (srcspan < n))
+		return -EINVAL;
+
+	/* Destination rows which don't match screen rows are marked as changed entirely */
+	offs = (unsigned char *)dst - (unsigned char *)sg->data;
+	x = (offs % span) / sg->depth;
+	y = offs / span;
+	if ((dstspan == span) && !(offs % sg->depth) && (x + dx <= sg->width))
+		softgraph_changed(sg, x, y, dx, dy);
+	else
+		softgraph_changed(sg, 0, y, sg->width, (offs + (size_t)(dy - 1) * dstspan + n - 1) / span - y + 1);
+
+	softgraph_copyTiled(sg, src, dst, dx, dy, srcspan, dstspan);
+
+	return 0;
+}
+
+
+/* Returns glyph bitmap, characters without glyph are rendered with the first (blank) one */
+static const unsigned char *softgraph_glyph(const softgraph_font_t *font, unsigned char c)
+{
+	return font->data + (size_t)((c > font->offs) ? c - font->offs : 0) * font->span * font->height;
+}
+
+
+static inline int softgraph_glyphPixel(const softgraph_font_t *font, const unsigned char *row, unsigned int i, unsigned char dx)
+{
+	unsigned int gx = i * font->width / dx;
+
+	return row[gx >> 3] & (1 << (gx & 7));
+}
+
+
+/* Finds next run of set pixels in scaled glyph row, returns run start (dx if there are no more runs) */
+static unsigned int softgraph_glyphRun(const softgraph_font_t *font, const unsigned char *row, unsigned int i, unsigned char dx, unsigned int *end)
+{
+	for (; (i < dx) && !softgraph_glyphPixel(font, row, i, dx); i++)
+		;
+
+	for (*end = i; (*end < dx) && softgraph_glyphPixel(font, row, *end, dx); (*end)++)
+		;
+
+	return i;
+}
+
+
+int softgraph_print(softgraph_t *sg, const softgraph_font_t *font, const char *text, unsigned int x, unsigned int y, unsigned char dx, unsigned char dy, unsigned int color)
+{
+	uint32_t pattern = softgraph_pattern(sg, color);
+	const unsigned char *glyph, *row;
+	unsigned int i, j, k, len = strlen(text);
+
+	if ((x + len * dx > sg->width) || (y + dy > sg->height))
+		return -EINVAL;
+
+	softgraph_changed(sg, x, y, len * dx, dy);
+
+	for (; *text != '\0'; text++, x += dx) {
+		glyph = softgraph_glyph(font, *text);
+
+		for (j = 0; j < dy; j++) {
+			row = glyph + (j * font->height / dy) * font->span;
+
+			/* Fill runs of set pixels as spans */
+			for (i = softgraph_glyphRun(font, row, 0, dx, &k); i < dx; i = softgraph_glyphRun(font, row, k, dx, &k))
+				softgraph_fill(sg, x + i, y + j, k - i, 1, pattern);
+		}
+	}
+
+	return 0;
+}
+
+
+int softgraph_cachePrint(softgraph_t *sg, const softgraph_cache_t *cache, const char *text, unsigned int x, unsigned int y, unsigned int color)
+{
+	uint32_t pattern = softgraph_pattern(sg, color);
+	const softgraph_run_t *run, *end;
+	unsigned int len = strlen(text), g;
+	unsigned char c;
+
+	if ((x + len * cache->dx > sg->width) || (y + cache->dy > sg->height))
+		return -EINVAL;
+
+	softgraph_changed(sg, x, y, len * cache->dx, cache->dy);
+
+	for (; (c = *text) != '\0'; text++, x += cache->dx) {
+		g = (c > cache->font->offs) ? c - cache->font->offs : 0;
+		if (g >= cache->nglyphs)
+			g = 0;
+
+		for (run = cache->runs + cache->offs[g], end = cache->runs + cache->offs[g + 1]; run < end; run++)
+			softgraph_fill(sg, x + run->x, y + run->y, run->n, 1, pattern);
+	}
+
+	return 0;
+}
+
+
+void softgraph_cacheDone(softgraph_cache_t *cache)
+{
+	free(cache->runs);
+	free(cache->offs);
+	cache->runs = NULL;
+	cache->offs = NULL;
+}
+
+
+int softgraph_cacheInit(softgraph_cache_t *cache, const softgraph_font_t *font, unsigned int nglyphs, unsigned char dx, unsigned char dy)
+{
+	const unsigned char *glyph, *row;
+	unsigned int g, i, j, k, pass, n;
+
+	if ((nglyphs == 0) || (dx == 0) || (dy == 0))
+		return -EINVAL;
+
+	cache->font = font;
+	cache->nglyphs = nglyphs;
+	cache->dx = dx;
+	cache->dy = dy;
+	cache->runs = NULL;
+
+	if ((cache->offs = malloc((nglyphs + 1) * sizeof(*cache->offs))) == NULL)
+		return -ENOMEM;
+
+	/* First pass counts runs, second one stores them */
+	for (pass = 0; pass < 2; pass++) {
+		for (g = 0, n = 0; g < nglyphs; g++) {
+			glyph = font->data + (size_t)g * font->span * font->height;
+			cache->offs[g] = n;
+
+			for (j = 0; j < dy; j++) {
+				row = glyph + (j * font->height / dy) * font->span;
+
+				for (i = softgraph_glyphRun(font, row, 0, dx, &k); i < dx; i = softgraph_glyphRun(font, row, k, dx, &k), n++) {
+					if (pass) {
+						cache->runs[n].x = i;
+						cache->runs[n].y = j;
+						cache->runs[n].n = k - i;
+					}
+				}
+			}
+		}
+		cache->offs[nglyphs] = n;
+
+		if (!pass && ((cache->runs = malloc((n ? n : 1) * sizeof(*cache->runs))) == NULL)) {
+			softgraph_cacheDone(cache);
+			return -ENOMEM;
+		}
+	}
+
+	return 0;
+}
+
+
+size_t softgraph_commit(softgraph_t *sg, void *fb)
+{
+	size_t span = (size_t)sg->depth * sg->width, n = (size_t)sg->depth * sg->dirty.dx;
+	size_t offs = sg->dirty.y * span + (size_t)sg->dirty.x * sg->depth;
+
+	if (softgraph_rectEmpty(&sg->dirty))
+		return 0;
+
+	softgraph_copyTiled(sg, (unsigned char *)sg->data + offs, (unsigned char *)fb + offs, sg->dirty.dx, sg->dirty.dy, span, span);
+
+	n *= sg->dirty.dy;
+	sg->dirty.dx = 0;
+	sg->dirty.dy = 0;
+
+	return n;
+}
+
+
+void softgraph_track(softgraph_t *sg, unsigned int bg)
+{
+	sg->bg = softgraph_pattern(sg, bg);
+	softgraph_fillTiled(sg, 0, 0, sg->width, sg->height, sg->bg);
+
+	sg->track = 1;
+	sg->ndamage = 0;
+	sg->dirty = (softgraph_rect_t) { 0, 0, sg->width, sg->height };
+}
+
+
+uint32_t softgraph_crc(const softgraph_t *sg)
+{
+	static const uint32_t tab[16] = {
+		0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+		0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+	};
+	const unsigned char *p = sg->data;
+	size_t i, n = (size_t)sg->depth * sg->width * sg->height;
+	uint32_t crc = 0xffffffff;
+
+	for (i = 0; i < n; i++) {
+		crc ^= p[i];
+		crc = (crc >> 4) ^ tab[crc & 0xf];
+		crc = (crc >> 4) ^ tab[crc & 0xf];
+	}
+
+	return ~crc;
+}
+
+
+int softgraph_workers(softgraph_t *sg, unsigned int n)
+{
+	softgraph_pool_t *pool = sg->pool;
+	unsigned int i;
+
+	/* Stop current workers */
+	if (pool != NULL) {
+		pthread_mutex_lock(&pool->lock);
+		pool->stop = 1;
+		pthread_cond_broadcast(&pool->start);
+		pthread_mutex_unlock(&pool->lock);
+
+		for (i = 0; i < pool->nthreads; i++)
+			pthread_join(pool->threads[i], NULL);
+
+		pthread_cond_destroy(&pool->finish);
+		pthread_cond_destroy(&pool->start);
+		pthread_mutex_destroy(&pool->lock);
+		free(pool);
+		sg->pool = NULL;
+	}
+
+	/* Calling thread is one of the workers */
+	if (n <= 1)
+		return 0;
+
+	if ((pool = calloc(1, sizeof(*pool) + (n - 1) * sizeof(pthread_t))) == NULL)
+		return -ENOMEM;
+
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->start, NULL);
+	pthread_cond_init(&pool->finish, NULL);
+	sg->pool = pool;
+
+	for (i = 0; i < n - 1; i++) {
+		if (pthread_create(&pool->threads[i], NULL, softgraph_worker, sg) != 0)
+			break;
+		pool->nthreads++;
+	}
+
+	if (pool->nthreads < n - 1) {
+		softgraph_workers(sg, 0);
+		return -ENOMEM;
+	}
+
+	return 0;
+}
+
+
+void softgraph_close(softgraph_t *sg)
+{
+	if (sg->pool != NULL)
+		softgraph_workers(sg, 0);
+
+	free(sg->data);
+	sg->data = NULL;
+}
+
+
+int softgraph_open(softgraph_t *sg, unsigned int width, unsigned int height, unsigned char depth)
+{
+	if ((depth != 1) && (depth != 2) && (depth != 4))
+		return -EINVAL;
+
+	if ((width == 0) || (height == 0))
+		return -EINVAL;
+
+	if ((sg->data = calloc((size_t)depth * width, height)) == NULL)
+		return -ENOMEM;
+
+	sg->track = 0;
+	sg->ndamage = 0;
+	sg->dirty = (softgraph_rect_t) { 0, 0, width, height };
+	sg->moved = 0;
+	sg->pool = NULL;
+
+	sg->width = width;
+	sg->height = height;
+	sg->depth = depth;
+
+	return 0;
+}
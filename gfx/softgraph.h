@@ -0,0 +1,139 @@
+/*
+ * Phoenix-RTOS
+ *
+ * Memory-backed software graphics target
+ *
+ * Implements graphics library primitives on a framebuffer in RAM,
+ * allowing to test and benchmark graphics code without a display
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#ifndef _SOFTGRAPH_H_
+#define _SOFTGRAPH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+#define SOFTGRAPH_DAMAGE  16           /* Max number of tracked damaged rectangles */
+#define SOFTGRAPH_BANDMIN (256 * 1024) /* Vertical moves with smaller bands (width x |my|) aren't split, each band synchronizes workers */
+
+
+/* Font in graph_font_t layout */
+typedef struct {
+	unsigned char width;       /* Glyph width in pixels */
+	unsigned char height;      /* Glyph height in pixels */
+	unsigned char span;        /* Glyph row span in bytes */
+	unsigned char offs;        /* First glyph character code */
+	const unsigned char *data; /* Glyphs bitmaps, LSB first */
+} softgraph_font_t;
+
+
+/* Run of set pixels in pre-rasterized glyph */
+typedef struct {
+	unsigned char x; /* Run start column */
+	unsigned char y; /* Run row */
+	unsigned char n; /* Run length */
+} softgraph_run_t;
+
+
+/* Glyphs of font pre-rasterized at fixed size */
+typedef struct {
+	const softgraph_font_t *font;
+	unsigned int nglyphs; /* Number of cached glyphs */
+	unsigned char dx;     /* Glyph width in pixels */
+	unsigned char dy;     /* Glyph height in pixels */
+	unsigned int *offs;   /* Glyphs first runs indexes, offs[nglyphs] is total number of runs */
+	softgraph_run_t *runs;
+} softgraph_cache_t;
+
+
+typedef struct softgraph_pool softgraph_pool_t;
+
+
+typedef struct {
+	unsigned int x;
+	unsigned int y;
+	unsigned int dx;
+	unsigned int dy;
+} softgraph_rect_t;
+
+
+typedef struct {
+	unsigned int width;                        /* Screen width in pixels */
+	unsigned int height;                       /* Screen height in pixels */
+	unsigned char depth;                       /* Color depth in bytes (1, 2 or 4) */
+	void *data;                                /* Framebuffer */
+
+	/* Damage tracking, all pixels outside damaged rectangles have background color */
+	int track;                                 /* Damage tracking enabled */
+	uint32_t bg;                               /* Background fill pattern */
+	unsigned int ndamage;                      /* Number of damaged rectangles */
+	softgraph_rect_t damage[SOFTGRAPH_DAMAGE]; /* Damaged rectangles */
+	softgraph_rect_t dirty;                    /* Area changed since last commit */
+	size_t moved;                              /* Number of bytes written by moves */
+
+	softgraph_pool_t *pool;                    /* Worker threads executing tiles of large operations */
+} softgraph_t;
+
+
+/* Draws filled rectangle */
+extern int softgraph_rect(softgraph_t *sg, unsigned int x, unsigned int y, unsigned int dx, unsigned int dy, unsigned int color);
+
+
+/* Draws line from (x, y) to (x + dx, y + dy) */
+extern int softgraph_line(softgraph_t *sg, unsigned int x, unsigned int y, int dx, int dy, unsigned int stroke, unsigned int color);
+
+
+/* Moves rectangle by (mx, my) */
+extern int softgraph_move(softgraph_t *sg, unsigned int x, unsigned int y, unsigned int dx, unsigned int dy, int mx, int my);
+
+
+/* Copies dx x dy pixels bitmap from src to dst, spans are in bytes */
+extern int softgraph_copy(softgraph_t *sg, const void *src, void *dst, unsigned int dx, unsigned int dy, unsigned int srcspan, unsigned int dstspan);
+
+
+/* Prints text scaling glyphs to dx x dy pixels */
+extern int softgraph_print(softgraph_t *sg, const softgraph_font_t *font, const char *text, unsigned int x, unsigned int y, unsigned char dx, unsigned char dy, unsigned int color);
+
+
+/* Prints text with glyphs pre-rasterized in cache */
+extern int softgraph_cachePrint(softgraph_t *sg, const softgraph_cache_t *cache, const char *text, unsigned int x, unsigned int y, unsigned int color);
+
+
+extern void softgraph_cacheDone(softgraph_cache_t *cache);
+
+
+/* Pre-rasterizes first nglyphs font glyphs scaled to dx x dy pixels */
+extern int softgraph_cacheInit(softgraph_cache_t *cache, const softgraph_font_t *font, unsigned int nglyphs, unsigned char dx, unsigned char dy);
+
+
+/* Copies area changed since last commit to fb, returns number of copied bytes */
+extern size_t softgraph_commit(softgraph_t *sg, void *fb);
+
+
+/* Fills screen with background color and starts damage tracking, moves touch only damaged areas */
+extern void softgraph_track(softgraph_t *sg, unsigned int bg);
+
+
+/* Splits large fills, moves and copies into tiles executed by n threads (including calling one) */
+extern int softgraph_workers(softgraph_t *sg, unsigned int n);
+
+
+/* Returns framebuffer CRC32 checksum */
+extern uint32_t softgraph_crc(const softgraph_t *sg);
+
+
+extern void softgraph_close(softgraph_t *sg);
+
+
+/* Allocates zeroed framebuffer */
+extern int softgraph_open(softgraph_t *sg, unsigned int width, unsigned int height, unsigned char depth);
+
+
+#endif
@@ -0,0 +1,209 @@
+/*
+ * Phoenix-RTOS
+ *
+ * phoenix-rtos-tests: compressed image assets tests
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "unity_fixture.h"
+
+#include "../bench_common.h"
+#include "asset.h"
+#include "softgraph.h"
+#include "logo8.h"
+#include "logo16.h"
+#include "logo24.h"
+#include "logo32.h"
+
+
+static const asset_t *test_assets[] = { &logo8, &logo16, &logo24, &logo32 };
+
+
+static struct {
+	softgraph_t sg;
+	unsigned char *buff;
+} asset_common;
+
+
+/* Returns CRC32 of decoded image */
+static uint32_t test_crc(const asset_t *asset, const void *data)
+{
+	softgraph_t img = { .width = asset->width * asset->depth, .height = asset->height, .depth = 1, .data = (void *)data };
+
+	return softgraph_crc(&img);
+}
+
+
+static void test_decode(const asset_t *asset)
+{
+	asset_common.buff = malloc(asset->depth * asset->width * asset->height);
+	TEST_ASSERT_NOT_NULL(asset_common.buff);
+	TEST_ASSERT_EQUAL_INT(0, asset_decode(asset, asset_common.buff, asset->depth * asset->width));
+}
+
+
+TEST_GROUP(asset);
+
+
+TEST_SETUP(asset)
+{
+}
+
+
+TEST_TEAR_DOWN(asset)
+{
+	softgraph_close(&asset_common.sg);
+	free(asset_common.buff);
+	asset_common.buff = NULL;
+}
+
+
+/* Decoded images are identical with original ones */
+TEST(asset, logos)
+{
+	unsigned int i;
+
+	for (i = 0; i < sizeof(test_assets) / sizeof(test_assets[0]); i++) {
+		test_decode(test_assets[i]);
+		TEST_ASSERT_EQUAL_HEX32(test_assets[i]->crc, test_crc(test_assets[i], asset_common.buff));
+
+		printf("test_asset: %ux%ux%u logo %u -> %u bytes\n", test_assets[i]->width, test_assets[i]->height, test_assets[i]->depth * 8,
+			test_assets[i]->depth * test_assets[i]->width * test_assets[i]->height, test_assets[i]->size);
+
+		free(asset_common.buff);
+		asset_common.buff = NULL;
+	}
+}
+
+
+/* Decoding straight into framebuffer gives the same output as copy of decoded image */
+TEST(asset, framebuffer)
+{
+	static const unsigned int x = 13, y = 7, width = 333, height = 211;
+	const asset_t *assets[] = { &logo8, &logo16, &logo32 };
+	unsigned char *ref, *fb;
+	unsigned int i, span;
+
+	for (i = 0; i < sizeof(assets) / sizeof(assets[0]); i++) {
+		span = assets[i]->depth * width;
+		test_decode(assets[i]);
+
+		TEST_ASSERT_EQUAL_INT(0, softgraph_open(&asset_common.sg, width, height, assets[i]->depth));
+		TEST_ASSERT_EQUAL_INT(0, softgraph_rect(&asset_common.sg, 0, 0, width, height, 0x5a5a5a5a));
+		fb = (unsigned char *)asset_common.sg.data + y * span + x * assets[i]->depth;
+		TEST_ASSERT_EQUAL_INT(0, softgraph_copy(&asset_common.sg, asset_common.buff, fb, assets[i]->width, assets[i]->height, assets[i]->depth * assets[i]->width, span));
+
+		ref = malloc(span * height);
+		TEST_ASSERT_NOT_NULL(ref);
+		memcpy(ref, asset_common.sg.data, span * height);
+
+		TEST_ASSERT_EQUAL_INT(0, softgraph_rect(&asset_common.sg, 0, 0, width, height, 0x5a5a5a5a));
+		TEST_ASSERT_EQUAL_INT(0, asset_decode(assets[i], fb, span));
+		TEST_ASSERT_EQUAL_HEX8_ARRAY(ref, asset_common.sg.data, span * height);
+
+		free(ref);
+		softgraph_close(&asset_common.sg);
+		free(asset_common.buff);
+		asset_common.buff = NULL;
+	}
+}
+
+
+TEST(asset, corrupted)
+{
+	/* 4x2 8-bit image: literal row, run row */
+	static const unsigned char data[] = { 0x03, 1, 2, 3, 4, 0x81, 5 };
+	static const unsigned char cross[] = { 0x86, 1, 0x81, 5 };
+	asset_t asset = { .width = 4, .height = 2, .depth = 1, .size = sizeof(data), .data = data };
+	unsigned char buff[8];
+
+	TEST_ASSERT_EQUAL_INT(0, asset_decode(&asset, buff, 4));
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(((unsigned char[]) { 1, 2, 3, 4, 5, 5, 5, 5 }), buff, sizeof(buff));
+
+	/* Truncated data */
+	asset.size = sizeof(data) - 1;
+	TEST_ASSERT_EQUAL_INT(-EINVAL, asset_decode(&asset, buff, 4));
+	asset.size = 3;
+	TEST_ASSERT_EQUAL_INT(-EINVAL, asset_decode(&asset, buff, 4));
+
+	/* Trailing data */
+	asset.height = 1;
+	asset.size = sizeof(data);
+	TEST_ASSERT_EQUAL_INT(-EINVAL, asset_decode(&asset, buff, 4));
+
+	/* Run crossing row boundary */
+	asset.height = 2;
+	asset.data = cross;
+	asset.size = sizeof(cross);
+	TEST_ASSERT_EQUAL_INT(-EINVAL, asset_decode(&asset, buff, 4));
+}
+
+
+/* Decoding throughput compared with copy of uncompressed image */
+TEST(asset, bench)
+{
+	unsigned int i, n = 200, size;
+	uint64_t start, tdecode, tcopy;
+	volatile unsigned char sink;
+	unsigned char *dst;
+
+	test_decode(&logo32);
+	size = logo32.depth * logo32.width * logo32.height;
+	dst = malloc(size);
+	TEST_ASSERT_NOT_NULL(dst);
+
+	/* Output is read after every iteration, so neither loop can be optimized out */
+	start = bench_now();
+	for (i = 0; i < n; i++) {
+		asset_decode(&logo32, dst, logo32.depth * logo32.width);
+		sink = dst[i % size];
+	}
+	tdecode = bench_now() - start;
+
+	start = bench_now();
+	for (i = 0; i < n; i++) {
+		memcpy(dst, asset_common.buff, size);
+		sink = dst[i % size];
+	}
+	tcopy = bench_now() - start;
+	(void)sink;
+
+	TEST_ASSERT_EQUAL_MEMORY(asset_common.buff, dst, size);
+
+	printf("test_asset: decode %" PRIu64 " MB/s, copy %" PRIu64 " MB/s\n", bench_rate((uint64_t)n * size, tdecode) >> 20, bench_rate((uint64_t)n * size, tcopy) >> 20);
+
+	free(dst);
+}
+
+
+TEST_GROUP_RUNNER(asset)
+{
+	RUN_TEST_CASE(asset, logos);
+	RUN_TEST_CASE(asset, framebuffer);
+	RUN_TEST_CASE(asset, corrupted);
+	RUN_TEST_CASE(asset, bench);
+}
+
+
+void runner(void)
+{
+	RUN_TEST_GROUP(asset);
+}
+
+
+int main(int argc, char *argv[])
+{
+	UnityMain(argc, (const char **)argv, runner);
+	return 0;
+}
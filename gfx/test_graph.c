@@ -17,16 +17,35 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <graph.h>
 
+#include "../bench_common.h"
+
 #include "cursor.h"
 #include "font.h"
+#include "softgraph.h"
 #include "logo8.h"
 #include "logo16.h"
 #include "logo32.h"
 
 
+#define TEST_FRAMES    8192 /* Max number of recorded frame times per test */
+#define TEST_CALIBRATE 64   /* Number of empty frames measuring vsync period */
+
+
+/* Slow-path (vsync synchronized) frames statistics */
+static struct {
+	bench_stats_t stats; /* Frame times */
+	uint64_t time;       /* Total time of recorded frames */
+	uint64_t last;       /* Last frame time */
+	unsigned int frames; /* Number of frames */
+	int chain;           /* Previous frame belongs to the same vsync synchronized section */
+	uint32_t period;     /* Vsync period measured with empty frames, 0 - no vsync */
+} test_frames;
+
+
 /* Forces all scheduled tasks completion */
 static int test_trigger(graph_t *graph)
 {
@@ -36,6 +55,72 @@ static int test_trigger(graph_t *graph)
 }
 
 
+/* Records vsync synchronized frame */
+static void test_frame(void)
+{
+	uint64_t now = bench_now();
+
+	if (test_frames.chain) {
+		bench_statsAdd(&test_frames.stats, now - test_frames.last);
+		test_frames.time += now - test_frames.last;
+	}
+
+	test_frames.frames++;
+	test_frames.chain = 1;
+	test_frames.last = now;
+}
+
+
+/* Ends vsync synchronized section, time until next frame isn't recorded */
+static void test_framesBreak(void)
+{
+	test_frames.chain = 0;
+}
+
+
+static void test_framesStart(void)
+{
+	bench_statsReset(&test_frames.stats);
+	test_frames.time = 0;
+	test_frames.frames = 0;
+	test_frames.chain = 0;
+}
+
+
+/* Prints frame time percentiles, missed vsyncs and achieved FPS */
+static void test_framesReport(const char *name)
+{
+	unsigned int i, missed = 0;
+	uint32_t period;
+	uint64_t time;
+	char buff[64];
+
+	if (test_frames.stats.n == 0)
+		return;
+
+	bench_statsSort(&test_frames.stats);
+	time = test_frames.time;
+	period = test_frames.period;
+
+	if (period == 0) {
+		/* Adapter without vsync, empty frames didn't wait for it */
+		printf("test_graph: %s %u frames, %" PRIu64 ".%" PRIu64 " fps, no vsync\n", name, test_frames.frames,
+			bench_rate(test_frames.stats.n, time), bench_rate(10 * (uint64_t)test_frames.stats.n, time) % 10);
+	}
+	else {
+		for (i = 0; i < test_frames.stats.n; i++) {
+			if (2 * test_frames.stats.samples[i] > 3 * period)
+				missed += (test_frames.stats.samples[i] + period / 2) / period - 1;
+		}
+
+		printf("test_graph: %s %u frames, %" PRIu64 ".%" PRIu64 " fps, vsync period ~%" PRIu32 " [us], %u missed vsyncs\n", name, test_frames.frames,
+			bench_rate(test_frames.stats.n, time), bench_rate(10 * (uint64_t)test_frames.stats.n, time) % 10, period, missed);
+	}
+	sprintf(buff, "test_graph: %s frame time", name);
+	bench_statsPrint(buff, &test_frames.stats);
+}
+
+
 /* Forces next scheduled task to run immediately after vsync */
 static int test_vtrigger(graph_t *graph)
 {
@@ -43,10 +128,211 @@ static int test_vtrigger(graph_t *graph)
 		;
 	while (!graph_vsync(graph))
 		;
+	test_frame();
 	return graph_commit(graph);
 }
 
 
+/* Measures vsync period with empty frames, which can't miss their vsyncs */
+static int test_framesCalibrate(graph_t *graph)
+{
+	unsigned int i;
+	int err;
+
+	test_framesStart();
+	for (i = 0; i < TEST_CALIBRATE; i++) {
+		if ((err = test_vtrigger(graph)) < 0)
+			return err;
+	}
+
+	/* Median skips short frames after vsyncs pending before calibration */
+	bench_statsSort(&test_frames.stats);
+	test_frames.period = bench_statsPct(&test_frames.stats, 50);
+	test_framesStart();
+
+	return EOK;
+}
+
+
+/* Number of primitives per commit, 1 - trigger and commit after every primitive */
+static const unsigned int bench_batch[] = { 1, 16, 256, 4096 };
+
+
+/* Measures primitives submission throughput with different numbers of primitives per commit */
+int test_bench(graph_t *graph, unsigned int nprims)
+{
+	unsigned int i, j, k, commits, flushes, tasks, maxtasks;
+	uint64_t start, end, tcommit, t, sumtasks;
+	int err;
+
+	printf("test_graph: %6s %10s %10s %10s %8s %12s\n", "batch", "prims/s", "avg queue", "max queue", "flushes", "commit [us]");
+
+	for (k = 0; k < sizeof(bench_batch) / sizeof(bench_batch[0]); k++) {
+		commits = flushes = maxtasks = 0;
+		tcommit = sumtasks = 0;
+
+		if ((err = test_trigger(graph)) < 0)
+			return err;
+
+		start = bench_now();
+		for (i = 0; i < nprims;) {
+			for (j = 0; (j < bench_batch[k]) && (i < nprims); j++, i++) {
+				for (;;) {
+					if (i & 1)
+						err = graph_line(graph, rand() % (graph->width - 64), rand() % (graph->height - 64), rand() % 64, rand() % 64, 1, rand() % (1ULL << 8 * graph->depth), GRAPH_QUEUE_HIGH);
+					else
+						err = graph_rect(graph, rand() % (graph->width - 16), rand() % (graph->height - 16), 16, 16, rand() % (1ULL << 8 * graph->depth), GRAPH_QUEUE_HIGH);
+
+					if (err != -ENOSPC)
+						break;
+
+					/* Task queue is full, flush it */
+					if ((err = test_trigger(graph)) < 0)
+						return err;
+					flushes++;
+				}
+
+				if (err < 0)
+					return err;
+			}
+
+			if ((tasks = graph_tasks(graph, GRAPH_QUEUE_HIGH)) > maxtasks)
+				maxtasks = tasks;
+			sumtasks += tasks;
+
+			t = bench_now();
+			if ((err = test_trigger(graph)) < 0)
+				return err;
+			tcommit += bench_now() - t;
+			commits++;
+		}
+		end = bench_now();
+
+		printf("test_graph: %6u %10" PRIu64 " %10" PRIu64 " %10u %8u %12" PRIu64 "\n", bench_batch[k], bench_rate(nprims, end - start),
+			sumtasks / commits, maxtasks, flushes, tcommit / commits);
+	}
+
+	return EOK;
+}
+
+
+/* Text benchmark glyph sizes */
+static const unsigned char text_sizes[][2] = { { 8, 16 }, { 16, 32 }, { 24, 48 }, { 32, 64 } };
+
+
+/* Measures full screen text pages rendering throughput for different glyph sizes */
+int test_text(graph_t *graph, unsigned int pages)
+{
+	static const char text[] = "Phoenix-RTOS test_graph 0123456789 abcdefghijklmnopqrstuvwxyz ABCDEFGHIJKLMNOPQRSTUVWXYZ !@#$%^&*()";
+	unsigned int i, j, k, cols, rows, color = (1ULL << 8 * graph->depth) - 1;
+	uint64_t start, end;
+	char *line;
+	int err = EOK;
+
+	if ((line = malloc(graph->width / text_sizes[0][0] + 1)) == NULL)
+		return -ENOMEM;
+
+	printf("test_graph: %6s %6s %10s %10s\n", "size", "glyphs", "pages/s", "glyphs/s");
+
+	for (k = 0; (err == EOK) && (k < sizeof(text_sizes) / sizeof(text_sizes[0])); k++) {
+		cols = graph->width / text_sizes[k][0];
+		rows = graph->height / text_sizes[k][1];
+
+		for (i = 0; i < cols; i++)
+			line[i] = text[i % (sizeof(text) - 1)];
+		line[cols] = '\0';
+
+		if ((err = test_trigger(graph)) < 0)
+			break;
+
+		start = bench_now();
+		for (i = 0; (err == EOK) && (i < pages); i++) {
+			for (j = 0; j < rows; j++) {
+				/* Task queue is full, flush it */
+				while ((err = graph_print(graph, &font, line, 0, j * text_sizes[k][1], text_sizes[k][0], text_sizes[k][1], color, GRAPH_QUEUE_HIGH)) == -ENOSPC) {
+					if ((err = test_trigger(graph)) < 0)
+						break;
+				}
+
+				if (err < 0)
+					break;
+			}
+
+			if ((err == EOK) && ((err = test_trigger(graph)) < 0))
+				break;
+		}
+		end = bench_now();
+
+		if (err == EOK)
+			printf("test_graph: %3ux%-2u %6u %10" PRIu64 " %10" PRIu64 "\n", text_sizes[k][0], text_sizes[k][1], rows * cols, bench_rate(pages, end - start), bench_rate((uint64_t)pages * rows * cols, end - start));
+	}
+
+	free(line);
+
+	return err;
+}
+
+
+/* Measures tiled software compositing throughput for 1 up to threads threads, composed frames are committed to screen */
+int test_tiles(graph_t *graph, unsigned int threads)
+{
+	unsigned int i, n, x, y, dx, dy, my, frames = 100;
+	uint64_t start, tfill, tscroll, twin;
+	size_t size = (size_t)graph->depth * graph->width * graph->height, win;
+	softgraph_t sg;
+	int err;
+
+	if ((err = softgraph_open(&sg, graph->width, graph->height, graph->depth)) < 0)
+		return err;
+
+	/* Window inset from screen edges moved up by enough rows for its bands to be split among threads */
+	x = sg.width / 8;
+	y = sg.height / 8;
+	dx = sg.width - 2 * x;
+	my = (SOFTGRAPH_BANDMIN + sg.depth * dx - 1) / (sg.depth * dx);
+	if (my > sg.height / 2) {
+		my = sg.height / 2;
+		printf("test_graph: window move bands below %u bytes, window move isn't split in this mode\n", SOFTGRAPH_BANDMIN);
+	}
+	dy = (sg.height - 2 * y > my) ? sg.height - 2 * y - my : 1;
+	win = (size_t)sg.depth * dx * dy;
+
+	/* Full width scroll is single memmove regardless of number of threads - baseline for window move */
+	printf("test_graph: %7s %10s %12s %12s\n", "threads", "fill MB/s", "scroll MB/s", "window MB/s");
+
+	for (n = 1; n <= threads; n++) {
+		if ((err = softgraph_workers(&sg, n)) < 0)
+			break;
+
+		start = bench_now();
+		for (i = 0; i < frames; i++)
+			softgraph_rect(&sg, 0, 0, sg.width, sg.height, i * 0x01010101);
+		tfill = bench_now() - start;
+
+		start = bench_now();
+		for (i = 0; i < frames; i++)
+			softgraph_move(&sg, 0, 1, sg.width, sg.height - 1, 0, -1);
+		tscroll = bench_now() - start;
+
+		start = bench_now();
+		for (i = 0; i < frames; i++)
+			softgraph_move(&sg, x, y + my, dx, dy, 0, -(int)my);
+		twin = bench_now() - start;
+
+		softgraph_commit(&sg, graph->data);
+		if ((err = test_trigger(graph)) < 0)
+			break;
+
+		printf("test_graph: %7u %10" PRIu64 " %12" PRIu64 " %12" PRIu64 "\n", n, bench_rate(frames * size, tfill) >> 20,
+			bench_rate(frames * size, tscroll) >> 20, bench_rate(frames * win, twin) >> 20);
+	}
+
+	softgraph_close(&sg);
+
+	return err;
+}
+
+
 int test_lines1(graph_t *graph, unsigned int dx, unsigned int dy, int step)
 {
 	unsigned int i;
@@ -67,6 +353,7 @@ int test_lines1(graph_t *graph, unsigned int dx, unsigned int dy, int step)
 		if ((err = graph_line(graph, rand() % (graph->width - 2 * dx - 2 * step) + step + dx, rand() % (graph->height - 2 * dy - 2 * step) + step + dy, rand() % (2 * dx) - dx, rand() % (2 * dy) - dy, 1, rand() % (1ULL << 8 * graph->depth), GRAPH_QUEUE_HIGH)) < 0)
 			return err;
 	}
+	test_framesBreak();
 
 	/* Move up */
 	for (i = 0; i < graph->height; i += step) {
@@ -136,6 +423,7 @@ int test_rectangles(graph_t *graph, unsigned int dx, unsigned int dy, int step)
 		if ((err = graph_rect(graph, rand() % (graph->width - dx - 2 * step) + step, rand() % (graph->height - dy - 2 * step) + step, dx, dy, rand() % (1ULL << 8 * graph->depth), GRAPH_QUEUE_HIGH)) < 0)
 			return err;
 	}
+	test_framesBreak();
 
 	/* Move right */
 	for (i = 0; i < graph->width; i += step) {
@@ -154,32 +442,26 @@ int test_logo(graph_t *graph, int step)
 	static const char text[] = "Phoenix-RTOS";                      /* Text under logo */
 	static const unsigned int fx = (sizeof(text) - 1) * font.width; /* Text width */
 	static const unsigned int fy = font.height;                     /* Text height */
-	static const unsigned int lx = 200;                             /* Logo width */
-	static const unsigned int ly = 150;                             /* Logo height */
-	static const unsigned int dy = ly + (6 * fy) / 5;               /* Total height */
-	const unsigned char *logo;
-	unsigned char buff[2][3];
-	unsigned int i, x, y, bg, fg;
+	const asset_t *asset;
+	unsigned char buff[2][3], *logo;
+	unsigned int i, x, y, lx, ly, dy, bg, fg;
 	int err, sy, ay;
 
 	switch (graph->depth) {
 		case 1:
-			logo = logo8[0];
-			bg = *(uint8_t *)logo;
+			asset = &logo8;
 			fg = 1;
 			graph_colorget(graph, buff[0], 0, 1);
 			graph_colorset(graph, cmap[0], 0, 1);
 			break;
 
 		case 2:
-			logo = logo16[0];
-			bg = *(uint16_t *)logo;
+			asset = &logo16;
 			fg = 0xffff;
 			break;
 
 		case 4:
-			logo = logo32[0];
-			bg = *(uint32_t *)logo;
+			asset = &logo32;
 			fg = 0xffffffff;
 			break;
 
@@ -188,15 +470,39 @@ int test_logo(graph_t *graph, int step)
 			return EOK;
 	}
 
+	lx = asset->width;
+	ly = asset->height;
+	dy = ly + (6 * fy) / 5;
 	x = graph->width - lx - 2 * step;
 	y = graph->height - dy - 2 * step;
 
-	/* Compose logo at bottom left corner */
-	if ((err = graph_rect(graph, 0, 0, graph->width, graph->height, bg, GRAPH_QUEUE_HIGH)) < 0)
-		return err;
-	if ((err = graph_copy(graph, logo, (void *)((uintptr_t)graph->data + graph->depth * ((graph->height - dy) * graph->width + step)), lx, ly, graph->depth * lx, graph->depth * graph->width, GRAPH_QUEUE_HIGH)) < 0)
+	/* Decompress logo */
+	if ((logo = malloc(asset->depth * lx * ly)) == NULL)
+		return -ENOMEM;
+
+	if ((err = asset_decode(asset, logo, asset->depth * lx)) < 0) {
+		free(logo);
 		return err;
-	if ((err = graph_print(graph, &font, text, step + (lx - fx) / 2 + 1, graph->height - fy, font.height, font.height, fg, GRAPH_QUEUE_HIGH)) < 0)
+	}
+
+	bg = 0;
+	memcpy(&bg, logo, asset->depth);
+
+	/* Compose logo at bottom left corner */
+	do {
+		if ((err = graph_rect(graph, 0, 0, graph->width, graph->height, bg, GRAPH_QUEUE_HIGH)) < 0)
+			break;
+		if ((err = graph_copy(graph, logo, (void *)((uintptr_t)graph->data + graph->depth * ((graph->height - dy) * graph->width + step)), lx, ly, graph->depth * lx, graph->depth * graph->width, GRAPH_QUEUE_HIGH)) < 0)
+			break;
+		if ((err = graph_print(graph, &font, text, step + (lx - fx) / 2 + 1, graph->height - fy, font.height, font.height, fg, GRAPH_QUEUE_HIGH)) < 0)
+			break;
+
+		/* Logo buffer has to stay valid until copy task completes */
+		err = test_trigger(graph);
+	} while (0);
+
+	free(logo);
+	if (err < 0)
 		return err;
 
 	/* Move right */
@@ -274,7 +580,7 @@ int test_cursor(graph_t *graph)
 
 void test_help(const char *prog)
 {
-	printf("Usage: %s [adapter] [-m mode] [-f freq]\n", prog);
+	printf("Usage: %s [adapter] [-m mode] [-f freq] [-b prims] [-t pages] [-j threads]\n", prog);
 	printf("\tGraphics adapters:\n");
 	printf("\t--cirrus     - use Cirrus Logic GD5446 VGA graphics adapter\n");
 	printf("\t--virtio-gpu - use VirtIO GPU graphics adapter\n");
@@ -282,6 +588,9 @@ void test_help(const char *prog)
 	printf("\tOther arguments:\n");
 	printf("\t-m, --mode   - graphics mode index\n");
 	printf("\t-f, --freq   - screen refresh rate index\n");
+	printf("\t-b, --bench  - run batched submission benchmark with given number of primitives\n");
+	printf("\t-t, --text   - run text rendering benchmark with given number of pages\n");
+	printf("\t-j, --jobs   - run tiled software compositing benchmark with up to given number of threads\n");
 	printf("\t-h, --help   - prints this help message\n");
 }
 
@@ -297,13 +606,17 @@ int main(int argc, char *argv[])
 		{ "vga", no_argument, &adapter, GRAPH_VGA },
 		{ "mode", required_argument, NULL, 'm' },
 		{ "freq", required_argument, NULL, 'f' },
+		{ "bench", required_argument, NULL, 'b' },
+		{ "text", required_argument, NULL, 't' },
+		{ "jobs", required_argument, NULL, 'j' },
 		{ "help", no_argument, NULL, 'h' },
 		{ NULL, 0, NULL, 0 }
 	};
+	unsigned int bench = 0, text = 0, jobs = 0;
 	graph_t graph;
 	int ret, c;
 
-	while ((c = getopt_long(argc, argv, "m:f:h", longopts, NULL)) != -1) {
+	while ((c = getopt_long(argc, argv, "m:f:b:t:j:h", longopts, NULL)) != -1) {
 		switch (c) {
 			case 0:
 				/* Graphics adapter */
@@ -319,6 +632,18 @@ int main(int argc, char *argv[])
 				freq = atoi(optarg) + 1;
 				break;
 
+			case 'b':
+				bench = atoi(optarg);
+				break;
+
+			case 't':
+				text = atoi(optarg);
+				break;
+
+			case 'j':
+				jobs = atoi(optarg);
+				break;
+
 			case 'h':
 			case '?':
 			default:
@@ -327,14 +652,21 @@ int main(int argc, char *argv[])
 		}
 	}
 
+	if (bench_statsInit(&test_frames.stats, TEST_FRAMES) < 0) {
+		fprintf(stderr, "test_graph: failed to allocate frames statistics\n");
+		return -ENOMEM;
+	}
+
 	if ((ret = graph_init()) < 0) {
 		fprintf(stderr, "test_graph: failed to initialize library\n");
+		bench_statsFree(&test_frames.stats);
 		return ret;
 	}
 
 	if ((ret = graph_open(&graph, adapter, 0x2000)) < 0) {
 		fprintf(stderr, "test_graph: failed to initialize graphics adapter\n");
 		graph_done();
+		bench_statsFree(&test_frames.stats);
 		return ret;
 	}
 
@@ -350,40 +682,77 @@ int main(int argc, char *argv[])
 			break;
 		}
 
+		if (bench) {
+			printf("test_graph: starting batched submission benchmark, %u primitives per batch size...\n", bench);
+			if ((ret = test_bench(&graph, bench)) < 0)
+				fprintf(stderr, "test_graph: batched submission benchmark failed\n");
+			break;
+		}
+
+		if (text) {
+			printf("test_graph: starting text rendering benchmark, %u pages per glyph size...\n", text);
+			if ((ret = test_text(&graph, text)) < 0)
+				fprintf(stderr, "test_graph: text rendering benchmark failed\n");
+			break;
+		}
+
+		if (jobs) {
+			printf("test_graph: starting tiled compositing benchmark, up to %u threads...\n", jobs);
+			if ((ret = test_tiles(&graph, jobs)) < 0)
+				fprintf(stderr, "test_graph: tiled compositing benchmark failed\n");
+			break;
+		}
+
+		if ((ret = test_framesCalibrate(&graph)) < 0) {
+			fprintf(stderr, "test_graph: vsync period calibration failed\n");
+			break;
+		}
+
 		printf("test_graph: starting lines1 test...\n");
+		test_framesStart();
 		if ((ret = test_lines1(&graph, 64, 64, 2)) < 0) {
 			fprintf(stderr, "test_graph: lines1 test failed\n");
 			break;
 		}
+		test_framesReport("lines1");
 
 		printf("test_graph: starting lines2 test...\n");
+		test_framesStart();
 		if ((ret = test_lines2(&graph, 64, 64, 2)) < 0) {
 			fprintf(stderr, "test_graph: lines2 test failed\n");
 			break;
 		}
+		test_framesReport("lines2");
 
 		printf("test_graph: starting rectangles test...\n");
+		test_framesStart();
 		if ((ret = test_rectangles(&graph, 32, 32, 2)) < 0) {
 			fprintf(stderr, "test_graph: rectangles test failed\n");
 			break;
 		}
+		test_framesReport("rectangles");
 
 		printf("test_graph: starting logo test...\n");
+		test_framesStart();
 		if ((ret = test_logo(&graph, 2)) < 0) {
 			fprintf(stderr, "test_graph: logo test failed\n");
 			break;
 		}
+		test_framesReport("logo");
 
 		printf("test_graph: starting cursor test...\n");
+		test_framesStart();
 		if ((ret = test_cursor(&graph)) < 0) {
 			fprintf(stderr, "test_graph: cursor test failed\n");
 			break;
 		}
+		test_framesReport("cursor");
 	} while (0);
 
 	test_trigger(&graph);
 	graph_close(&graph);
 	graph_done();
+	bench_statsFree(&test_frames.stats);
 
 	if (!ret)
 		printf("test_graph: test finished successfully\n");
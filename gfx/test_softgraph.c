@@ -0,0 +1,858 @@
+/*
+ * Phoenix-RTOS
+ *
+ * phoenix-rtos-tests: software graphics target pixel-exact tests
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "unity_fixture.h"
+
+#include "../bench_common.h"
+#include "softgraph.h"
+#include "vgarom.h"
+
+
+#define TEST_WIDTH  123 /* Odd width, so rows start at different alignments */
+#define TEST_HEIGHT 77
+#define TEST_OPS    2000 /* Random operations per test and depth */
+
+
+static const softgraph_font_t test_font = {
+	.width = 16,
+	.height = 32,
+	.span = 2,
+	.offs = ' ' - 1,
+	.data = vgarom16x32[0]
+};
+
+
+/* Text benchmark glyph sizes */
+static const unsigned char test_sizes[][2] = { { 8, 16 }, { 16, 32 }, { 24, 48 }, { 32, 64 } };
+
+
+#define TEST_GLYPHS (sizeof(vgarom16x32) / (2 * 32))
+
+
+/* Golden scene checksums for 1, 2 and 4 bytes depth (little-endian targets) */
+static const uint32_t test_golden[] = { 0xae0b4872, 0x70442279, 0x578150b0 };
+
+
+static struct {
+	softgraph_t sg;          /* Tested target */
+	softgraph_t plain;       /* Target without damage tracking */
+	softgraph_cache_t cache; /* Glyph cache */
+	unsigned char *ref;      /* Reference framebuffer, drawn pixel by pixel */
+	unsigned char *bmp;      /* Source bitmap for copy tests */
+	unsigned int seed;
+} softgraph_common;
+
+
+/* Platform independent pseudo-random numbers generator (golden images have to be reproducible) */
+static unsigned int test_rand(void)
+{
+	softgraph_common.seed = softgraph_common.seed * 1103515245 + 12345;
+	return (softgraph_common.seed >> 16) & 0x7fff;
+}
+
+
+/*
+ * Reference implementation
+ */
+
+
+static void ref_pixel(unsigned int x, unsigned int y, unsigned int color)
+{
+	unsigned char *p = softgraph_common.ref + softgraph_common.sg.depth * (y * softgraph_common.sg.width + x);
+
+	switch (softgraph_common.sg.depth) {
+		case 1:
+			*p = color;
+			break;
+
+		case 2:
+			*(uint16_t *)p = color;
+			break;
+
+		default:
+			*(uint32_t *)p = color;
+			break;
+	}
+}
+
+
+static void ref_rect(unsigned int x, unsigned int y, unsigned int dx, unsigned int dy, unsigned int color)
+{
+	unsigned int i, j;
+
+	for (j = y; j < y + dy; j++) {
+		for (i = x; i < x + dx; i++)
+			ref_pixel(i, j, color);
+	}
+}
+
+
+static void ref_line(unsigned int x, unsigned int y, int dx, int dy, unsigned int stroke, unsigned int color)
+{
+	int sx = (dx < 0) ? -1 : 1, sy = (dy < 0) ? -1 : 1;
+	int ax = abs(dx), ay = abs(dy), err, i;
+
+	if (ax >= ay) {
+		for (i = 0, err = ax / 2; i <= ax; i++, x += sx) {
+			ref_rect(x, y, stroke, stroke, color);
+			if ((err -= ay) < 0) {
+				err += ax;
+				y += sy;
+			}
+		}
+	}
+	else {
+		for (i = 0, err = ay / 2; i <= ay; i++, y += sy) {
+			ref_rect(x, y, stroke, stroke, color);
+			if ((err -= ax) < 0) {
+				err += ay;
+				x += sx;
+			}
+		}
+	}
+}
+
+
+static void ref_move(unsigned int x, unsigned int y, unsigned int dx, unsigned int dy, int mx, int my)
+{
+	unsigned int span = softgraph_common.sg.depth * softgraph_common.sg.width, n = softgraph_common.sg.depth * dx, j;
+	unsigned char *tmp = malloc(n * dy + 1);
+
+	TEST_ASSERT_NOT_NULL(tmp);
+
+	for (j = 0; j < dy; j++)
+		memcpy(tmp + j * n, softgraph_common.ref + (y + j) * span + x * softgraph_common.sg.depth, n);
+	for (j = 0; j < dy; j++)
+		memcpy(softgraph_common.ref + (y + my + j) * span + (x + mx) * softgraph_common.sg.depth, tmp + j * n, n);
+
+	free(tmp);
+}
+
+
+static void ref_print(const char *text, unsigned int x, unsigned int y, unsigned int dx, unsigned int dy, unsigned int color)
+{
+	const unsigned char *glyph;
+	unsigned int i, j, gx, gy;
+	unsigned char c;
+
+	for (; (c = *text) != '\0'; text++, x += dx) {
+		glyph = test_font.data + ((c > test_font.offs) ? c - test_font.offs : 0) * test_font.span * test_font.height;
+
+		for (j = 0; j < dy; j++) {
+			for (i = 0; i < dx; i++) {
+				gx = i * test_font.width / dx;
+				gy = j * test_font.height / dy;
+				if (glyph[gy * test_font.span + (gx >> 3)] & (1 << (gx & 7)))
+					ref_pixel(x + i, y + j, color);
+			}
+		}
+	}
+}
+
+
+/*
+ * Helpers
+ */
+
+
+static void test_open(unsigned int width, unsigned int height, unsigned char depth)
+{
+	TEST_ASSERT_EQUAL_INT(0, softgraph_open(&softgraph_common.sg, width, height, depth));
+	softgraph_common.ref = calloc(depth * width, height);
+	TEST_ASSERT_NOT_NULL(softgraph_common.ref);
+}
+
+
+static void test_close(void)
+{
+	softgraph_close(&softgraph_common.sg);
+	free(softgraph_common.ref);
+	softgraph_common.ref = NULL;
+}
+
+
+static void test_compare(void)
+{
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(softgraph_common.ref, softgraph_common.sg.data, softgraph_common.sg.depth * softgraph_common.sg.width * softgraph_common.sg.height);
+}
+
+
+static unsigned int test_color(void)
+{
+	return ((test_rand() << 17) ^ (test_rand() << 2) ^ test_rand()) & (0xffffffffU >> (32 - 8 * softgraph_common.sg.depth));
+}
+
+
+TEST_GROUP(softgraph);
+
+
+TEST_SETUP(softgraph)
+{
+	softgraph_common.seed = 1;
+}
+
+
+TEST_TEAR_DOWN(softgraph)
+{
+	softgraph_cacheDone(&softgraph_common.cache);
+	softgraph_close(&softgraph_common.plain);
+	test_close();
+}
+
+
+TEST(softgraph, rect)
+{
+	unsigned int depth, x, y, dx, dy, color, i;
+
+	for (depth = 1; depth <= 4; depth <<= 1) {
+		test_open(TEST_WIDTH, TEST_HEIGHT, depth);
+
+		/* Every span start alignment and length around vector sizes */
+		for (x = 0; x < 20; x++) {
+			for (dx = 0; dx <= 70; dx++) {
+				color = test_color();
+				TEST_ASSERT_EQUAL_INT(0, softgraph_rect(&softgraph_common.sg, x, x, dx, 2, color));
+				ref_rect(x, x, dx, 2, color);
+			}
+		}
+		test_compare();
+
+		for (i = 0; i < TEST_OPS; i++) {
+			x = test_rand() % TEST_WIDTH;
+			y = test_rand() % TEST_HEIGHT;
+			dx = test_rand() % (TEST_WIDTH - x + 1);
+			dy = test_rand() % (TEST_HEIGHT - y + 1);
+			color = test_color();
+			TEST_ASSERT_EQUAL_INT(0, softgraph_rect(&softgraph_common.sg, x, y, dx, dy, color));
+			ref_rect(x, y, dx, dy, color);
+		}
+		test_compare();
+
+		/* Full screen */
+		color = test_color();
+		TEST_ASSERT_EQUAL_INT(0, softgraph_rect(&softgraph_common.sg, 0, 0, TEST_WIDTH, TEST_HEIGHT, color));
+		ref_rect(0, 0, TEST_WIDTH, TEST_HEIGHT, color);
+		test_compare();
+
+		test_close();
+	}
+}
+
+
+TEST(softgraph, line)
+{
+	unsigned int depth, x, y, stroke, color, i;
+	int dx, dy;
+
+	for (depth = 1; depth <= 4; depth <<= 1) {
+		test_open(TEST_WIDTH, TEST_HEIGHT, depth);
+
+		for (i = 0; i < TEST_OPS; i++) {
+			stroke = 1 + test_rand() % 3;
+			x = test_rand() % (TEST_WIDTH - stroke);
+			y = test_rand() % (TEST_HEIGHT - stroke);
+			dx = (int)(test_rand() % (TEST_WIDTH - stroke)) - (int)x;
+			dy = (int)(test_rand() % (TEST_HEIGHT - stroke)) - (int)y;
+
+			/* Axis aligned lines */
+			if (i % 8 == 0)
+				dx = 0;
+			else if (i % 8 == 1)
+				dy = 0;
+
+			color = test_color();
+			TEST_ASSERT_EQUAL_INT(0, softgraph_line(&softgraph_common.sg, x, y, dx, dy, stroke, color));
+			ref_line(x, y, dx, dy, stroke, color);
+		}
+		test_compare();
+
+		test_close();
+	}
+}
+
+
+TEST(softgraph, move)
+{
+	unsigned int depth, x, y, dx, dy, i;
+	int mx, my;
+
+	for (depth = 1; depth <= 4; depth <<= 1) {
+		test_open(TEST_WIDTH, TEST_HEIGHT, depth);
+
+		/* Random content */
+		for (i = 0; i < depth * TEST_WIDTH * TEST_HEIGHT; i++)
+			softgraph_common.ref[i] = ((unsigned char *)softgraph_common.sg.data)[i] = test_rand();
+
+		for (i = 0; i < TEST_OPS; i++) {
+			/* Full width vertical moves (scrolling) */
+			if (i % 4 == 0) {
+				x = 0;
+				dx = TEST_WIDTH;
+				mx = 0;
+				my = (int)(test_rand() % 21) - 10;
+				y = (my < 0) ? -my : 0;
+				dy = TEST_HEIGHT - abs(my);
+			}
+			else {
+				mx = (int)(test_rand() % 41) - 20;
+				my = (int)(test_rand() % 41) - 20;
+				x = (mx < 0) ? -mx + test_rand() % (TEST_WIDTH + mx) : test_rand() % (TEST_WIDTH - mx);
+				y = (my < 0) ? -my + test_rand() % (TEST_HEIGHT + my) : test_rand() % (TEST_HEIGHT - my);
+				dx = test_rand() % (TEST_WIDTH - ((mx < 0) ? x : x + mx) + 1);
+				dy = test_rand() % (TEST_HEIGHT - ((my < 0) ? y : y + my) + 1);
+			}
+
+			TEST_ASSERT_EQUAL_INT(0, softgraph_move(&softgraph_common.sg, x, y, dx, dy, mx, my));
+			ref_move(x, y, dx, dy, mx, my);
+		}
+		test_compare();
+
+		test_close();
+	}
+}
+
+
+TEST(softgraph, copy)
+{
+	unsigned int depth, x, y, dx, dy, span, offs, i;
+	unsigned char *dst;
+
+	softgraph_common.bmp = malloc(4 * TEST_WIDTH * TEST_HEIGHT + 3);
+	TEST_ASSERT_NOT_NULL(softgraph_common.bmp);
+	for (i = 0; i < 4 * TEST_WIDTH * TEST_HEIGHT + 3; i++)
+		softgraph_common.bmp[i] = test_rand();
+
+	for (depth = 1; depth <= 4; depth <<= 1) {
+		test_open(TEST_WIDTH, TEST_HEIGHT, depth);
+
+		for (i = 0; i < TEST_OPS; i++) {
+			x = test_rand() % TEST_WIDTH;
+			y = test_rand() % TEST_HEIGHT;
+			dx = test_rand() % (TEST_WIDTH - x + 1);
+			dy = test_rand() % (TEST_HEIGHT - y + 1);
+			/* Continuous and strided source bitmaps at unaligned addresses */
+			span = depth * dx + ((i & 1) ? test_rand() % 16 : 0);
+			offs = test_rand() % 4;
+			if (span * dy + offs > 4 * TEST_WIDTH * TEST_HEIGHT + 3)
+				dy = 1;
+
+			dst = (unsigned char *)softgraph_common.sg.data + depth * (y * TEST_WIDTH + x);
+			TEST_ASSERT_EQUAL_INT(0, softgraph_copy(&softgraph_common.sg, softgraph_common.bmp + offs, dst, dx, dy, span, depth * TEST_WIDTH));
+
+			for (y = 0; y < dy; y++)
+				memcpy(softgraph_common.ref + (dst - (unsigned char *)softgraph_common.sg.data) + y * depth * TEST_WIDTH, softgraph_common.bmp + offs + y * span, depth * dx);
+		}
+		test_compare();
+
+		/* Continuous full screen copy */
+		TEST_ASSERT_EQUAL_INT(0, softgraph_copy(&softgraph_common.sg, softgraph_common.bmp, softgraph_common.sg.data, TEST_WIDTH, TEST_HEIGHT, depth * TEST_WIDTH, depth * TEST_WIDTH));
+		memcpy(softgraph_common.ref, softgraph_common.bmp, depth * TEST_WIDTH * TEST_HEIGHT);
+		test_compare();
+
+		test_close();
+	}
+
+	free(softgraph_common.bmp);
+}
+
+
+TEST(softgraph, print)
+{
+	static const char text[] = "Phoenix-RTOS 0123456789 ~!@#$%^&*()";
+	unsigned int depth, x, y, dx, dy, len, color, i;
+
+	for (depth = 1; depth <= 4; depth <<= 1) {
+		test_open(4 * TEST_WIDTH, TEST_HEIGHT, depth);
+
+		for (i = 0; i < TEST_OPS / 10; i++) {
+			dx = 1 + test_rand() % 40;
+			dy = 1 + test_rand() % 70;
+			len = 1 + test_rand() % (4 * TEST_WIDTH / dx);
+			if (len > sizeof(text) - 1)
+				len = sizeof(text) - 1;
+			x = test_rand() % (4 * TEST_WIDTH - len * dx + 1);
+			y = test_rand() % (TEST_HEIGHT - dy + 1);
+			color = test_color();
+
+			TEST_ASSERT_EQUAL_INT(0, softgraph_print(&softgraph_common.sg, &test_font, text + sizeof(text) - 1 - len, x, y, dx, dy, color));
+			ref_print(text + sizeof(text) - 1 - len, x, y, dx, dy, color);
+		}
+		test_compare();
+
+		test_close();
+	}
+}
+
+
+TEST(softgraph, cache)
+{
+	static const char text[] = "Phoenix-RTOS 0123456789 ~!@#$%^&*()";
+	unsigned int depth, x, y, dx, dy, len, color, i;
+	char buff[sizeof(text)], ref[sizeof(text)];
+
+	for (depth = 1; depth <= 4; depth <<= 1) {
+		test_open(4 * TEST_WIDTH, TEST_HEIGHT, depth);
+
+		for (i = 0; i < TEST_OPS / 20; i++) {
+			dx = 1 + test_rand() % 40;
+			dy = 1 + test_rand() % 70;
+			len = 1 + test_rand() % (4 * TEST_WIDTH / dx);
+			if (len > sizeof(text) - 1)
+				len = sizeof(text) - 1;
+			x = test_rand() % (4 * TEST_WIDTH - len * dx + 1);
+			y = test_rand() % (TEST_HEIGHT - dy + 1);
+			color = test_color();
+
+			TEST_ASSERT_EQUAL_INT(0, softgraph_cacheInit(&softgraph_common.cache, &test_font, TEST_GLYPHS, dx, dy));
+			TEST_ASSERT_EQUAL_INT(0, softgraph_cachePrint(&softgraph_common.sg, &softgraph_common.cache, text + sizeof(text) - 1 - len, x, y, color));
+			ref_print(text + sizeof(text) - 1 - len, x, y, dx, dy, color);
+			softgraph_cacheDone(&softgraph_common.cache);
+		}
+		test_compare();
+
+		/* All characters, ones without cached glyph are rendered blank */
+		TEST_ASSERT_EQUAL_INT(0, softgraph_cacheInit(&softgraph_common.cache, &test_font, 100, 8, 16));
+		for (i = 1, len = 0; i < 256; i++) {
+			buff[len] = i;
+			ref[len++] = (i < test_font.offs + 100U) ? i : ' ';
+
+			if ((len == sizeof(buff) - 1) || (i == 255)) {
+				buff[len] = ref[len] = '\0';
+				y = 16 * (i / (sizeof(buff) - 1)) % (TEST_HEIGHT - 16);
+				color = test_color();
+				TEST_ASSERT_EQUAL_INT(0, softgraph_cachePrint(&softgraph_common.sg, &softgraph_common.cache, buff, 0, y, color));
+				ref_print(ref, 0, y, 8, 16, color);
+				len = 0;
+			}
+		}
+		softgraph_cacheDone(&softgraph_common.cache);
+		test_compare();
+
+		test_close();
+	}
+}
+
+
+TEST(softgraph, invalid)
+{
+	test_open(TEST_WIDTH, TEST_HEIGHT, 4);
+
+	TEST_ASSERT_EQUAL_INT(-EINVAL, softgraph_rect(&softgraph_common.sg, 1, 0, TEST_WIDTH, 1, 1));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, softgraph_rect(&softgraph_common.sg, 0, TEST_HEIGHT, 1, 1, 1));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, softgraph_rect(&softgraph_common.sg, 1, 1, ~0U, 1, 1));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, softgraph_line(&softgraph_common.sg, 0, 0, 10, 10, 0, 1));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, softgraph_line(&softgraph_common.sg, 5, 5, -6, 0, 1, 1));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, softgraph_line(&softgraph_common.sg, 0, TEST_HEIGHT - 2, 0, 1, 2, 1));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, softgraph_move(&softgraph_common.sg, 0, 0, TEST_WIDTH, 1, 1, 0));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, softgraph_move(&softgraph_common.sg, 0, 0, 1, 1, 0, -1));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, softgraph_copy(&softgraph_common.sg, softgraph_common.ref, (uint32_t *)softgraph_common.sg.data + 1, TEST_WIDTH, TEST_HEIGHT, 4 * TEST_WIDTH, 4 * TEST_WIDTH));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, softgraph_print(&softgraph_common.sg, &test_font, "Phoenix-RTOS", TEST_WIDTH - 11 * 10, 0, 10, 10, 1));
+
+	/* Nothing has been drawn */
+	test_compare();
+
+	TEST_ASSERT_EQUAL_INT(-EINVAL, softgraph_open(&softgraph_common.sg, TEST_WIDTH, TEST_HEIGHT, 3));
+}
+
+
+/* Runs random operation on both tracked and plain targets */
+static void test_damageOp(unsigned int i)
+{
+	softgraph_t *sg[] = { &softgraph_common.sg, &softgraph_common.plain };
+	unsigned int x, y, dx, dy, px, py, color, k, op = test_rand() % 16;
+	int mx, my;
+
+	x = test_rand() % TEST_WIDTH;
+	y = test_rand() % TEST_HEIGHT;
+	dx = 1 + test_rand() % 30;
+	dy = 1 + test_rand() % 30;
+	color = test_color();
+	mx = (int)(test_rand() % 9) - 4;
+	my = (int)(test_rand() % 9) - 4;
+	px = (mx < 0) ? -mx + x % (TEST_WIDTH + mx) : x % (TEST_WIDTH - mx);
+	py = (my < 0) ? -my + y % (TEST_HEIGHT + my) : y % (TEST_HEIGHT - my);
+
+	for (k = 0; k < 2; k++) {
+		switch (op) {
+			case 0:
+				softgraph_rect(sg[k], x % (TEST_WIDTH - dx), y % (TEST_HEIGHT - dy), dx, dy, color);
+				break;
+
+			case 1:
+				softgraph_line(sg[k], x % (TEST_WIDTH - dx - 1), y % (TEST_HEIGHT - dy - 1), dx, (i & 1) ? dy : 0, 1, color);
+				break;
+
+			case 2:
+				softgraph_print(sg[k], &test_font, "Phoenix", x % (TEST_WIDTH - 7 * 8), y % (TEST_HEIGHT - 16), 8, 16, color);
+				break;
+
+			case 3:
+				softgraph_copy(sg[k], softgraph_common.bmp, (unsigned char *)sg[k]->data + sg[k]->depth * ((y % (TEST_HEIGHT - dy)) * TEST_WIDTH + x % (TEST_WIDTH - dx)), dx, dy, sg[k]->depth * dx, sg[k]->depth * TEST_WIDTH);
+				break;
+
+			case 4:
+				/* Rare full screen fill changes background */
+				if (i % 8 == 0)
+					softgraph_rect(sg[k], 0, 0, TEST_WIDTH, TEST_HEIGHT, color);
+				break;
+
+			case 5:
+			case 6:
+				/* Scrolling */
+				softgraph_move(sg[k], 0, (my < 0) ? -my : 0, TEST_WIDTH, TEST_HEIGHT - abs(my), 0, my);
+				break;
+
+			case 7:
+				softgraph_move(sg[k], (mx < 0) ? -mx : 0, 0, TEST_WIDTH - abs(mx), TEST_HEIGHT, mx, 0);
+				break;
+
+			default:
+				/* Partial moves */
+				softgraph_move(sg[k], px, py, (TEST_WIDTH - ((mx < 0) ? px : px + mx)) / 2, (TEST_HEIGHT - ((my < 0) ? py : py + my)) / 2, mx, my);
+				break;
+		}
+	}
+}
+
+
+/* Damage tracking doesn't change output, commit copies all changes */
+TEST(softgraph, damage)
+{
+	unsigned int depth, i;
+	unsigned char *disp;
+
+	softgraph_common.bmp = malloc(4 * 30 * 30);
+	TEST_ASSERT_NOT_NULL(softgraph_common.bmp);
+	for (i = 0; i < 4 * 30 * 30; i++)
+		softgraph_common.bmp[i] = test_rand();
+
+	for (depth = 1; depth <= 4; depth <<= 1) {
+		test_open(TEST_WIDTH, TEST_HEIGHT, depth);
+		TEST_ASSERT_EQUAL_INT(0, softgraph_open(&softgraph_common.plain, TEST_WIDTH, TEST_HEIGHT, depth));
+
+		/* Display framebuffer updated with commits, reference framebuffer buffer is reused */
+		disp = softgraph_common.ref;
+		softgraph_track(&softgraph_common.sg, 0x1234567);
+		TEST_ASSERT_EQUAL_INT(0, softgraph_rect(&softgraph_common.plain, 0, 0, TEST_WIDTH, TEST_HEIGHT, 0x1234567));
+
+		for (i = 0; i < 10 * TEST_OPS; i++) {
+			test_damageOp(i);
+			TEST_ASSERT_EQUAL_MEMORY(softgraph_common.plain.data, softgraph_common.sg.data, depth * TEST_WIDTH * TEST_HEIGHT);
+
+			if (i % 10 == 0) {
+				softgraph_commit(&softgraph_common.sg, disp);
+				TEST_ASSERT_EQUAL_MEMORY(softgraph_common.sg.data, disp, depth * TEST_WIDTH * TEST_HEIGHT);
+			}
+		}
+
+		softgraph_close(&softgraph_common.plain);
+		test_close();
+	}
+
+	free(softgraph_common.bmp);
+}
+
+
+/* Logo scrolling as in test_graph - bytes moved and committed per frame */
+TEST(softgraph, scroll)
+{
+	static const unsigned int width = 640, height = 480, lx = 200, ly = 150, step = 2;
+	softgraph_t *sg[] = { &softgraph_common.plain, &softgraph_common.sg };
+	size_t moved[2], committed[2];
+	unsigned int i, k, frames;
+	unsigned char *disp;
+
+	softgraph_common.bmp = malloc(4 * lx * ly);
+	TEST_ASSERT_NOT_NULL(softgraph_common.bmp);
+	for (i = 0; i < 4 * lx * ly; i++)
+		softgraph_common.bmp[i] = test_rand();
+
+	test_open(width, height, 4);
+	TEST_ASSERT_EQUAL_INT(0, softgraph_open(&softgraph_common.plain, width, height, 4));
+	disp = softgraph_common.ref;
+
+	for (k = 0; k < 2; k++) {
+		if (k)
+			softgraph_track(sg[k], 0);
+		else
+			softgraph_rect(sg[k], 0, 0, width, height, 0);
+
+		TEST_ASSERT_EQUAL_INT(0, softgraph_copy(sg[k], softgraph_common.bmp, (uint32_t *)sg[k]->data + (height - ly) * width + step, lx, ly, 4 * lx, 4 * width));
+		softgraph_commit(sg[k], disp);
+		sg[k]->moved = 0;
+		committed[k] = 0;
+
+		/* Move right, then up */
+		for (i = 0, frames = 0; i < width - lx - 2 * step; i += step, frames++) {
+			TEST_ASSERT_EQUAL_INT(0, softgraph_move(sg[k], 0, height - ly - step, width - step, ly, step, 0));
+			committed[k] += softgraph_commit(sg[k], disp);
+		}
+
+		for (i = 0; i < height; i += step, frames++) {
+			TEST_ASSERT_EQUAL_INT(0, softgraph_move(sg[k], 0, step, width, height - step, 0, -(int)step));
+			committed[k] += softgraph_commit(sg[k], disp);
+		}
+		moved[k] = sg[k]->moved;
+	}
+
+	TEST_ASSERT_EQUAL_MEMORY(softgraph_common.plain.data, softgraph_common.sg.data, 4 * width * height);
+
+	printf("test_softgraph: scroll %u frames, moved %zu -> %zu bytes/frame, committed %zu -> %zu bytes/frame\n", frames,
+		moved[0] / frames, moved[1] / frames, committed[0] / frames, committed[1] / frames);
+	TEST_ASSERT_LESS_THAN(moved[0], moved[1]);
+
+	free(softgraph_common.bmp);
+}
+
+
+/* Large operations split into tiles give the same output as single-threaded ones */
+TEST(softgraph, tiles)
+{
+	static const unsigned int width = 800, height = 600;
+	softgraph_t *sg[] = { &softgraph_common.plain, &softgraph_common.sg };
+	unsigned int depth, i, k, x, y, dx, dy;
+	unsigned char *disp;
+	int mx, my;
+
+	softgraph_common.bmp = malloc(4 * width * height);
+	TEST_ASSERT_NOT_NULL(softgraph_common.bmp);
+	for (i = 0; i < 4 * width * height; i++)
+		softgraph_common.bmp[i] = test_rand();
+
+	for (depth = 1; depth <= 4; depth <<= 1) {
+		test_open(width, height, depth);
+		TEST_ASSERT_EQUAL_INT(0, softgraph_open(&softgraph_common.plain, width, height, depth));
+		TEST_ASSERT_EQUAL_INT(0, softgraph_workers(&softgraph_common.sg, 4));
+		disp = softgraph_common.ref;
+
+		for (i = 0; i < TEST_OPS / 10; i++) {
+			x = test_rand() % (width / 2);
+			y = test_rand() % (height / 2);
+			dx = 1 + test_rand() % (width - x - 1);
+			dy = 1 + test_rand() % (height - y - 1);
+			mx = (i % 3 == 1) ? 0 : (int)(test_rand() % (width - dx - x + 1)) - (int)x;
+			my = (i % 3 == 2) ? 0 : (int)(test_rand() % (height - dy - y + 1)) - (int)y;
+
+			for (k = 0; k < 2; k++) {
+				TEST_ASSERT_EQUAL_INT(0, softgraph_rect(sg[k], x, y, dx, dy, i * 0x01010101));
+				TEST_ASSERT_EQUAL_INT(0, softgraph_copy(sg[k], softgraph_common.bmp, (unsigned char *)sg[k]->data + depth * (y * width + x), dx, dy, depth * width, depth * width));
+				TEST_ASSERT_EQUAL_INT(0, softgraph_move(sg[k], x, y, dx, dy, mx, my));
+			}
+			TEST_ASSERT_EQUAL_MEMORY(softgraph_common.plain.data, softgraph_common.sg.data, depth * width * height);
+
+			softgraph_commit(&softgraph_common.sg, disp);
+			TEST_ASSERT_EQUAL_MEMORY(softgraph_common.sg.data, disp, depth * width * height);
+		}
+
+		/* Vertical and diagonal moves split into bands (for larger depths), full width scrolls */
+		for (k = 0; k < 2; k++) {
+			TEST_ASSERT_EQUAL_INT(0, softgraph_copy(sg[k], softgraph_common.bmp, sg[k]->data, width, height, depth * width, depth * width));
+			TEST_ASSERT_EQUAL_INT(0, softgraph_move(sg[k], 100, 0, width - 200, 400, 0, 150));
+			TEST_ASSERT_EQUAL_INT(0, softgraph_move(sg[k], 50, 200, width - 100, 400, 0, -200));
+			TEST_ASSERT_EQUAL_INT(0, softgraph_move(sg[k], 0, 0, width - 30, 440, 30, 110));
+			TEST_ASSERT_EQUAL_INT(0, softgraph_move(sg[k], 0, 10, width, height - 10, 0, -10));
+		}
+		TEST_ASSERT_EQUAL_MEMORY(softgraph_common.plain.data, softgraph_common.sg.data, depth * width * height);
+
+		/* Damage tracking with worker threads */
+		softgraph_track(&softgraph_common.sg, 0x55aa55aa);
+		softgraph_rect(&softgraph_common.plain, 0, 0, width, height, 0x55aa55aa);
+		for (k = 0; k < 2; k++) {
+			TEST_ASSERT_EQUAL_INT(0, softgraph_copy(sg[k], softgraph_common.bmp, (unsigned char *)sg[k]->data + depth * (100 * width + 100), 300, 200, depth * width, depth * width));
+			TEST_ASSERT_EQUAL_INT(0, softgraph_move(sg[k], 0, 50, width, height - 50, 0, -50));
+			TEST_ASSERT_EQUAL_INT(0, softgraph_move(sg[k], 0, 0, width - 70, height, 70, 0));
+		}
+		TEST_ASSERT_EQUAL_MEMORY(softgraph_common.plain.data, softgraph_common.sg.data, depth * width * height);
+
+		softgraph_close(&softgraph_common.plain);
+		test_close();
+	}
+
+	free(softgraph_common.bmp);
+}
+
+
+/* Fill and move throughput scaling with number of threads */
+TEST(softgraph, threads)
+{
+	static const unsigned int threads[] = { 1, 2, 4 };
+	unsigned int i, j, n = 50;
+	uint64_t start, tfill, tmove, twin;
+	size_t size = 4 * 1280 * 720, win = 4 * 1264 * 656;
+
+	/* Window move bands are large enough to be split */
+	TEST_ASSERT_GREATER_OR_EQUAL(SOFTGRAPH_BANDMIN, 4 * 1264 * 64);
+
+	test_open(1280, 720, 4);
+
+	for (i = 0; i < sizeof(threads) / sizeof(threads[0]); i++) {
+		TEST_ASSERT_EQUAL_INT(0, softgraph_workers(&softgraph_common.sg, threads[i]));
+
+		start = bench_now();
+		for (j = 0; j < n; j++)
+			softgraph_rect(&softgraph_common.sg, 1, 1, 1278, 718, j);
+		tfill = bench_now() - start;
+
+		start = bench_now();
+		for (j = 0; j < n; j++)
+			softgraph_move(&softgraph_common.sg, 0, 2, 1280, 718, 0, -2);
+		tmove = bench_now() - start;
+
+		/* Window scrolling - vertical move split into bands, full width move above is single memmove */
+		start = bench_now();
+		for (j = 0; j < n; j++)
+			softgraph_move(&softgraph_common.sg, 8, 64, 1264, 656, 0, -64);
+		twin = bench_now() - start;
+
+		printf("test_softgraph: %u threads fill %" PRIu64 " MB/s, move %" PRIu64 " MB/s, window move %" PRIu64 " MB/s\n", threads[i],
+			bench_rate(n * size, tfill) >> 20, bench_rate(n * size, tmove) >> 20, bench_rate(n * win, twin) >> 20);
+	}
+}
+
+
+/* Fixed scene of all primitives compared against golden image checksums */
+TEST(softgraph, golden)
+{
+	unsigned int depth, i;
+	uint32_t crc;
+
+	for (depth = 1; depth <= 4; depth <<= 1) {
+		softgraph_common.seed = 1;
+		test_open(320, 200, depth);
+
+		TEST_ASSERT_EQUAL_INT(0, softgraph_rect(&softgraph_common.sg, 0, 0, 320, 200, test_color()));
+		for (i = 0; i < 100; i++)
+			TEST_ASSERT_EQUAL_INT(0, softgraph_rect(&softgraph_common.sg, test_rand() % 288, test_rand() % 168, 1 + test_rand() % 32, 1 + test_rand() % 32, test_color()));
+		for (i = 0; i < 100; i++)
+			TEST_ASSERT_EQUAL_INT(0, softgraph_line(&softgraph_common.sg, 64 + test_rand() % 192, 64 + test_rand() % 72, (int)(test_rand() % 128) - 64, (int)(test_rand() % 128) - 64, 1 + i % 2, test_color()));
+		TEST_ASSERT_EQUAL_INT(0, softgraph_print(&softgraph_common.sg, &test_font, "Phoenix-RTOS", 64, 84, 16, 32, test_color()));
+		TEST_ASSERT_EQUAL_INT(0, softgraph_print(&softgraph_common.sg, &test_font, "Phoenix-RTOS", 10, 10, 8, 16, test_color()));
+		TEST_ASSERT_EQUAL_INT(0, softgraph_copy(&softgraph_common.sg, softgraph_common.sg.data, (unsigned char *)softgraph_common.sg.data + depth * (120 * 320 + 160), 150, 80, depth * 320, depth * 320));
+		TEST_ASSERT_EQUAL_INT(0, softgraph_move(&softgraph_common.sg, 0, 3, 320, 197, 0, -3));
+		TEST_ASSERT_EQUAL_INT(0, softgraph_move(&softgraph_common.sg, 10, 10, 200, 150, 7, 5));
+
+		crc = softgraph_crc(&softgraph_common.sg);
+		printf("test_softgraph: depth %u golden image crc 0x%08x\n", depth, (unsigned int)crc);
+		TEST_ASSERT_EQUAL_HEX32(test_golden[depth >> 1], crc);
+
+		test_close();
+	}
+}
+
+
+/* Fill and blit throughput at typical screen size */
+TEST(softgraph, bench)
+{
+	unsigned int depth, i, n = 100;
+	uint64_t start, tfill, tmove, tcopy;
+	size_t size;
+
+	for (depth = 1; depth <= 4; depth <<= 1) {
+		test_open(640, 480, depth);
+		size = (size_t)depth * 640 * 480;
+
+		start = bench_now();
+		for (i = 0; i < n; i++)
+			softgraph_rect(&softgraph_common.sg, 1, 1, 638, 478, i);
+		tfill = bench_now() - start;
+
+		start = bench_now();
+		for (i = 0; i < n; i++)
+			softgraph_move(&softgraph_common.sg, 0, 2, 640, 478, 0, -2);
+		tmove = bench_now() - start;
+
+		start = bench_now();
+		for (i = 0; i < n; i++)
+			softgraph_copy(&softgraph_common.sg, softgraph_common.ref + depth, (unsigned char *)softgraph_common.sg.data + depth, 638, 480, depth * 640, depth * 640);
+		tcopy = bench_now() - start;
+
+		printf("test_softgraph: depth %u fill %" PRIu64 " MB/s, move %" PRIu64 " MB/s, copy %" PRIu64 " MB/s\n", depth,
+			bench_rate(n * size, tfill) >> 20, bench_rate(n * size, tmove) >> 20, bench_rate(n * size, tcopy) >> 20);
+
+		test_close();
+	}
+}
+
+
+/* Full screen text pages rendering throughput */
+TEST(softgraph, text)
+{
+	static const char text[] = "Phoenix-RTOS test_softgraph 0123456789 abcdefghijklmnopqrstuvwxyz ABCDEFGHIJKLMNOPQRSTUVWXYZ !@#$%^&*()";
+	unsigned int i, j, pages = 5, cols, rows, glyphs;
+	uint64_t start, tprint, tcache;
+	char line[256];
+
+	test_open(640, 480, 4);
+
+	for (i = 0; i < sizeof(test_sizes) / sizeof(test_sizes[0]); i++) {
+		cols = 640 / test_sizes[i][0];
+		rows = 480 / test_sizes[i][1];
+		glyphs = pages * rows * cols;
+
+		for (j = 0; j < cols; j++)
+			line[j] = text[j % (sizeof(text) - 1)];
+		line[cols] = '\0';
+
+		start = bench_now();
+		for (j = 0; j < pages * rows; j++)
+			softgraph_print(&softgraph_common.sg, &test_font, line, 0, (j % rows) * test_sizes[i][1], test_sizes[i][0], test_sizes[i][1], j);
+		tprint = bench_now() - start;
+
+		TEST_ASSERT_EQUAL_INT(0, softgraph_cacheInit(&softgraph_common.cache, &test_font, TEST_GLYPHS, test_sizes[i][0], test_sizes[i][1]));
+		start = bench_now();
+		for (j = 0; j < pages * rows; j++)
+			softgraph_cachePrint(&softgraph_common.sg, &softgraph_common.cache, line, 0, (j % rows) * test_sizes[i][1], j);
+		tcache = bench_now() - start;
+		softgraph_cacheDone(&softgraph_common.cache);
+
+		printf("test_softgraph: text %ux%u %" PRIu64 " glyphs/s, cached %" PRIu64 " glyphs/s\n", test_sizes[i][0], test_sizes[i][1],
+			bench_rate(glyphs, tprint), bench_rate(glyphs, tcache));
+	}
+}
+
+
+TEST_GROUP_RUNNER(softgraph)
+{
+	RUN_TEST_CASE(softgraph, rect);
+	RUN_TEST_CASE(softgraph, line);
+	RUN_TEST_CASE(softgraph, move);
+	RUN_TEST_CASE(softgraph, copy);
+	RUN_TEST_CASE(softgraph, print);
+	RUN_TEST_CASE(softgraph, cache);
+	RUN_TEST_CASE(softgraph, damage);
+	RUN_TEST_CASE(softgraph, invalid);
+	RUN_TEST_CASE(softgraph, golden);
+	RUN_TEST_CASE(softgraph, bench);
+	RUN_TEST_CASE(softgraph, text);
+	RUN_TEST_CASE(softgraph, scroll);
+	RUN_TEST_CASE(softgraph, tiles);
+	RUN_TEST_CASE(softgraph, threads);
+}
+
+
+void runner(void)
+{
+	RUN_TEST_GROUP(softgraph);
+}
+
+
+int main(int argc, char *argv[])
+{
+	UnityMain(argc, (const char **)argv, runner);
+	return 0;
+}
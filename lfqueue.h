@@ -0,0 +1,208 @@
+/*
+ * Phoenix-RTOS
+ *
+ * phoenix-rtos-tests
+ *
+ * Bounded lock-free ring queues
+ *
+ * lfq_spsc_t - single producer, single consumer
+ * lfq_mpmc_t - multiple producers, multiple consumers (D. Vyukov's bounded queue)
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#ifndef LFQUEUE_H
+#define LFQUEUE_H
+
+#include <stdlib.h>
+
+
+#define LFQ_CACHELINE 64
+
+
+typedef struct {
+	void **items;
+	unsigned int mask;
+	unsigned int head __attribute__((aligned(LFQ_CACHELINE))); /* Next write position, modified by producer */
+	unsigned int tail __attribute__((aligned(LFQ_CACHELINE))); /* Next read position, modified by consumer */
+} lfq_spsc_t;
+
+
+typedef struct {
+	unsigned int seq; /* Cell sequence number, tells whether cell is ready for write or read */
+	void *item;
+} lfq_cell_t;
+
+
+typedef struct {
+	lfq_cell_t *cells;
+	unsigned int mask;
+	unsigned int head __attribute__((aligned(LFQ_CACHELINE))); /* Next write position */
+	unsigned int tail __attribute__((aligned(LFQ_CACHELINE))); /* Next read position */
+} lfq_mpmc_t;
+
+
+/*
+ * Single producer, single consumer queue
+ */
+
+
+/* Initializes queue, size has to be a power of 2 */
+static inline int lfq_spscInit(lfq_spsc_t *q, unsigned int size)
+{
+	if ((size == 0) || (size & (size - 1)))
+		return -1;
+
+	if ((q->items = malloc(size * sizeof(*q->items))) == NULL)
+		return -1;
+
+	q->mask = size - 1;
+	q->head = 0;
+	q->tail = 0;
+
+	return 0;
+}
+
+
+static inline void lfq_spscDone(lfq_spsc_t *q)
+{
+	free(q->items);
+	q->items = NULL;
+}
+
+
+/* Returns -1 if queue is full */
+static inline int lfq_spscPush(lfq_spsc_t *q, void *item)
+{
+	unsigned int head = __atomic_load_n(&q->head, __ATOMIC_RELAXED);
+
+	if (head - __atomic_load_n(&q->tail, __ATOMIC_ACQUIRE) > q->mask)
+		return -1;
+
+	q->items[head & q->mask] = item;
+	__atomic_store_n(&q->head, head + 1, __ATOMIC_RELEASE);
+
+	return 0;
+}
+
+
+/* Returns -1 if queue is empty */
+static inline int lfq_spscPop(lfq_spsc_t *q, void **item)
+{
+	unsigned int tail = __atomic_load_n(&q->tail, __ATOMIC_RELAXED);
+
+	if (tail == __atomic_load_n(&q->head, __ATOMIC_ACQUIRE))
+		return -1;
+
+	*item = q->items[tail & q->mask];
+	__atomic_store_n(&q->tail, tail + 1, __ATOMIC_RELEASE);
+
+	return 0;
+}
+
+
+/*
+ * Multiple producers, multiple consumers queue
+ */
+
+
+/* Initializes queue, size has to be a power of 2 */
+static inline int lfq_mpmcInit(lfq_mpmc_t *q, unsigned int size)
+{
+	unsigned int i;
+
+	if ((size < 2) || (size & (size - 1)))
+		return -1;
+
+	if ((q->cells = malloc(size * sizeof(*q->cells))) == NULL)
+		return -1;
+
+	for (i = 0; i < size; i++)
+		q->cells[i].seq = i;
+
+	q->mask = size - 1;
+	q->head = 0;
+	q->tail = 0;
+
+	return 0;
+}
+
+
+static inline void lfq_mpmcDone(lfq_mpmc_t *q)
+{
+	free(q->cells);
+	q->cells = NULL;
+}
+
+
+/* Returns -1 if queue is full */
+static inline int lfq_mpmcPush(lfq_mpmc_t *q, void *item)
+{
+	unsigned int pos = __atomic_load_n(&q->head, __ATOMIC_RELAXED);
+	lfq_cell_t *cell;
+	int diff;
+
+	for (;;) {
+		cell = &q->cells[pos & q->mask];
+		diff = (int)(__atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE) - pos);
+
+		if (diff == 0) {
+			/* Cell is free, try to claim it (pos is updated on failure) */
+			if (__atomic_compare_exchange_n(&q->head, &pos, pos + 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+				break;
+		}
+		else if (diff < 0) {
+			/* Cell still holds item from the previous lap */
+			return -1;
+		}
+		else {
+			/* Other producer claimed the cell */
+			pos = __atomic_load_n(&q->head, __ATOMIC_RELAXED);
+		}
+	}
+
+	cell->item = item;
+	__atomic_store_n(&cell->seq, pos + 1, __ATOMIC_RELEASE);
+
+	return 0;
+}
+
+
+/* Returns -1 if queue is empty */
+static inline int lfq_mpmcPop(lfq_mpmc_t *q, void **item)
+{
+	unsigned int pos = __atomic_load_n(&q->tail, __ATOMIC_RELAXED);
+	lfq_cell_t *cell;
+	int diff;
+
+	for (;;) {
+		cell = &q->cells[pos & q->mask];
+		diff = (int)(__atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE) - (pos + 1));
+
+		if (diff == 0) {
+			/* Cell is filled, try to claim it (pos is updated on failure) */
+			if (__atomic_compare_exchange_n(&q->tail, &pos, pos + 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+				break;
+		}
+		else if (diff < 0) {
+			/* Cell not written yet */
+			return -1;
+		}
+		else {
+			/* Other consumer claimed the cell */
+			pos = __atomic_load_n(&q->tail, __ATOMIC_RELAXED);
+		}
+	}
+
+	*item = cell->item;
+	/* Mark cell free for the producer in the next lap */
+	__atomic_store_n(&cell->seq, pos + q->mask + 1, __ATOMIC_RELEASE);
+
+	return 0;
+}
+
+#endif
@@ -16,6 +16,8 @@
 /* make compilable against glibc (all these tests were run on host against libc/linux kernel) */
 #define _GNU_SOURCE
 
+#include <pthread.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
@@ -28,9 +30,29 @@
 
 #include <unity_fixture.h>
 
+#include "../bench_common.h"
 #include "common.h"
 
 
+#define BENCH_SIZE (256 * 1024) /* Bytes transferred per stdio benchmark */
+#define BENCH_LINE 64           /* Benchmark line length (with newline) */
+
+
+/* Tested stream buffering, mode -1 leaves libc defaults */
+static const struct {
+	const char *name;
+	int mode;
+	size_t size;
+} bench_bufs[] = {
+	{ "def", -1, 0 },
+	{ "nbf", _IONBF, 0 },
+	{ "lbf", _IOLBF, 1024 },
+	{ "fbf", _IOFBF, 256 },
+	{ "fbf", _IOFBF, 4096 },
+	{ "fbf", _IOFBF, 65536 }
+};
+
+
 TEST_GROUP(file);
 
 TEST_SETUP(file)
@@ -75,8 +97,195 @@ TEST(file, fclose_stdin_ebadf)
 }
 
 
+/*
+ * stdio throughput benchmarks
+ */
+
+
+static void *bench_drain(void *arg)
+{
+	char buf[4096];
+	int fd = (int)(intptr_t)arg;
+
+	while (read(fd, buf, sizeof(buf)) > 0)
+		;
+	close(fd);
+
+	return NULL;
+}
+
+
+/* opens benchmarked stream: 0 - regular file, 1 - pipe (drained by thread), 2 - /dev/null */
+static FILE *bench_open(int target, const char *mode, pthread_t *reader)
+{
+	int fds[2];
+	FILE *f;
+
+	if (target == 0)
+		return fopen("/tmp/stdio_bench", mode);
+
+	if (target == 2)
+		return fopen("/dev/null", mode);
+
+	if (pipe(fds) < 0)
+		return NULL;
+
+	if (pthread_create(reader, NULL, bench_drain, (void *)(intptr_t)fds[0]) != 0) {
+		close(fds[0]);
+		close(fds[1]);
+		return NULL;
+	}
+
+	if ((f = fdopen(fds[1], mode)) == NULL) {
+		close(fds[1]);
+		pthread_join(*reader, NULL);
+		close(fds[0]);
+		return NULL;
+	}
+
+	return f;
+}
+
+
+/* writes BENCH_SIZE bytes with given operation (0 - fwrite, 1 - fputs, 2 - fprintf), returns KB/s */
+static uint64_t bench_write(int target, int op, int mode, size_t size)
+{
+	char line[BENCH_LINE + 1], *buf = NULL;
+	pthread_t reader;
+	uint64_t start;
+	unsigned int i;
+	FILE *f;
+
+	memset(line, 'a', BENCH_LINE - 1);
+	line[BENCH_LINE - 1] = '\n';
+	line[BENCH_LINE] = '\0';
+
+	f = bench_open(target, "w", &reader);
+	TEST_ASSERT_NOT_NULL(f);
+
+	if (mode >= 0) {
+		if (size != 0) {
+			buf = malloc(size);
+			TEST_ASSERT_NOT_NULL(buf);
+		}
+		TEST_ASSERT_EQUAL_INT(0, setvbuf(f, buf, mode, size));
+	}
+
+	start = bench_now();
+	for (i = 0; i < BENCH_SIZE / BENCH_LINE; i++) {
+		switch (op) {
+			case 0:
+				fwrite(line, 1, BENCH_LINE, f);
+				break;
+
+			case 1:
+				fputs(line, f);
+				break;
+
+			default:
+				/* 64 characters line */
+				fprintf(f, "%10u %08x %-21s %21s\n", i, i, "stdio", "bench");
+				break;
+		}
+	}
+	TEST_ASSERT_EQUAL_INT(0, fclose(f));
+	start = bench_now() - start;
+
+	if (target == 1)
+		pthread_join(reader, NULL);
+
+	free(buf);
+
+	return bench_rate(BENCH_SIZE, start) >> 10;
+}
+
+
+/* reads BENCH_SIZE bytes file written by bench_write() with given operation (0 - fread, 1 - fgets), returns KB/s */
+static uint64_t bench_read(int op, int mode, size_t size)
+{
+	char line[BENCH_LINE + 1], *buf = NULL;
+	uint64_t start;
+	size_t total = 0;
+	FILE *f;
+
+	f = fopen("/tmp/stdio_bench", "r");
+	TEST_ASSERT_NOT_NULL(f);
+
+	if (mode >= 0) {
+		if (size != 0) {
+			buf = malloc(size);
+			TEST_ASSERT_NOT_NULL(buf);
+		}
+		TEST_ASSERT_EQUAL_INT(0, setvbuf(f, buf, mode, size));
+	}
+
+	start = bench_now();
+	if (op == 0) {
+		while (fread(line, 1, BENCH_LINE, f) == BENCH_LINE)
+			total += BENCH_LINE;
+	}
+	else {
+		while (fgets(line, sizeof(line), f) != NULL)
+			total += strlen(line);
+	}
+	TEST_ASSERT_EQUAL_INT(0, fclose(f));
+	start = bench_now() - start;
+
+	free(buf);
+	TEST_ASSERT_EQUAL_INT(BENCH_SIZE, total);
+
+	return bench_rate(total, start) >> 10;
+}
+
+
+/* fwrite/fputs/fprintf throughput to file, pipe and /dev/null */
+TEST(file, bench_write)
+{
+	static const char *targets[] = { "file", "pipe", "null" };
+	uint64_t rate[3];
+	unsigned int i;
+	int target, op;
+
+	printf("file: %-6s %-4s %6s %10s %10s %10s [KB/s]\n", "target", "mode", "buffer", "fwrite", "fputs", "fprintf");
+	for (target = 0; target < 3; target++) {
+		for (i = 0; i < sizeof(bench_bufs) / sizeof(bench_bufs[0]); i++) {
+			for (op = 0; op < 3; op++)
+				rate[op] = bench_write(target, op, bench_bufs[i].mode, bench_bufs[i].size);
+
+			printf("file: %-6s %-4s %6zu %10" PRIu64 " %10" PRIu64 " %10" PRIu64 "\n", targets[target], bench_bufs[i].name, bench_bufs[i].size, rate[0], rate[1], rate[2]);
+		}
+	}
+
+	unlink("/tmp/stdio_bench");
+}
+
+
+/* fread/fgets throughput from file */
+TEST(file, bench_read)
+{
+	uint64_t rate[2];
+	unsigned int i;
+
+	/* file with BENCH_SIZE bytes of lines */
+	bench_write(0, 1, -1, 0);
+
+	printf("file: %-4s %6s %10s %10s [KB/s]\n", "mode", "buffer", "fread", "fgets");
+	for (i = 0; i < sizeof(bench_bufs) / sizeof(bench_bufs[0]); i++) {
+		rate[0] = bench_read(0, bench_bufs[i].mode, bench_bufs[i].size);
+		rate[1] = bench_read(1, bench_bufs[i].mode, bench_bufs[i].size);
+
+		printf("file: %-4s %6zu %10" PRIu64 " %10" PRIu64 "\n", bench_bufs[i].name, bench_bufs[i].size, rate[0], rate[1]);
+	}
+
+	unlink("/tmp/stdio_bench");
+}
+
+
 TEST_GROUP_RUNNER(file)
 {
 	RUN_TEST_CASE(file, fclose_stdin);
 	RUN_TEST_CASE(file, fclose_stdin_ebadf);
+
+	RUN_TEST_CASE(file, bench_write);
+	RUN_TEST_CASE(file, bench_read);
 }
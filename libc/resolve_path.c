@@ -28,8 +28,14 @@
 
 #include <unity_fixture.h>
 
+#include "../bench_common.h"
 #include "common.h"
 
+
+#define BENCH_DEPTH 16   /* Number of path components in deep path benchmark */
+#define BENCH_HOPS  6    /* Number of symlink hops in symlinks benchmark */
+#define BENCH_ITERS 2000 /* Resolutions per benchmark */
+
 /* Tests verifying correctness of resolving paths in libphoenix.
  * The same tests can be compiled for host-pc to verify our assumptions against glibc.
  */
@@ -422,9 +428,20 @@ TEST(resolve_path, symlink_loop)
 	TEST_ASSERT_EQUAL_INT(-1, chdir("symlink1"));
 	TEST_ASSERT_EQUAL_INT(ELOOP, errno);
 
+	/* break the loop - previous (cached) result must not be reused */
+	unlink("real_file");
+	create_file("real_file", file_contents);
+	TEST_ASSERT_EQUAL_INT(0, unlink("symlink1"));
+	if (symlink("real_file", "symlink1") < 0)
+		TEST_FAIL_MESSAGE(strerror(errno));
+
+	check_and_free_str("/tmp/real_file", canonicalize_file_name("symlink2"));
+	check_file_contents(file_contents, "symlink2");
+
 	/* cleanup - WARN: if failed - not reached */
 	unlink("symlink1");
 	unlink("symlink2");
+	unlink("real_file");
 }
 
 
@@ -444,13 +461,24 @@ TEST(resolve_path, symlink_rename)
 		TEST_FAIL_MESSAGE(strerror(errno));
 
 	check_file_contents(file_contents, "symlink_old");
+	check_and_free_str("/tmp/real_file", canonicalize_file_name("symlink_old"));
 
 	if (rename("symlink_old", "symlink_new") < 0)
 		TEST_FAIL_MESSAGE(strerror(errno));
 
 	check_file_contents(file_contents, "real_file");
 	check_file_open_errno(ENOENT, "symlink_old");
+	check_null_and_errno(ENOENT, canonicalize_file_name("symlink_old"));
 	check_file_contents(file_contents, "symlink_new");
+	check_and_free_str("/tmp/real_file", canonicalize_file_name("symlink_new"));
+
+	/* renaming the target breaks the symlink */
+	if (rename("real_file", "real_file2") < 0)
+		TEST_FAIL_MESSAGE(strerror(errno));
+
+	check_null_and_errno(ENOENT, canonicalize_file_name("symlink_new"));
+	check_and_free_str("/tmp/real_file2", canonicalize_file_name("real_file2"));
+	TEST_ASSERT_EQUAL_INT(0, rename("real_file2", "real_file"));
 
 	/* cleanup - WARN: if failed - not reached */
 	TEST_ASSERT_EQUAL_INT(0, unlink("symlink_new"));
@@ -458,6 +486,116 @@ TEST(resolve_path, symlink_rename)
 }
 
 
+/* removes benchmark tree created by bench_mkTree() */
+static void bench_rmTree(void)
+{
+	char path[PATH_MAX];
+	int i, len;
+
+	for (i = 0; i < BENCH_HOPS; i++) {
+		TEST_ASSERT_LESS_THAN_INT(sizeof(path), snprintf(path, sizeof(path), "/tmp/rp_bench/l%d", i));
+		unlink(path);
+	}
+
+	len = snprintf(path, sizeof(path), "/tmp/rp_bench");
+	for (i = 0; i < BENCH_DEPTH; i++) {
+		len += snprintf(path + len, sizeof(path) - len, "/d");
+		TEST_ASSERT_LESS_THAN_INT(sizeof(path), len);
+	}
+
+	for (i = BENCH_DEPTH; i >= 0; i--) {
+		rmdir(path);
+		*strrchr(path, '/') = 0;
+	}
+}
+
+
+/* creates /tmp/rp_bench/d/d/.../d directories and l0 -> l1 -> ... -> d symlink chain, returns deepest dir path */
+static void bench_mkTree(char *path)
+{
+	char target[PATH_MAX], link[PATH_MAX];
+	int i, len;
+
+	bench_rmTree();
+
+	len = snprintf(path, PATH_MAX, "/tmp/rp_bench");
+	TEST_ASSERT_EQUAL_INT(0, mkdir(path, 0755));
+	for (i = 0; i < BENCH_DEPTH; i++) {
+		len += snprintf(path + len, PATH_MAX - len, "/d");
+		TEST_ASSERT_LESS_THAN_INT(PATH_MAX, len);
+		TEST_ASSERT_EQUAL_INT(0, mkdir(path, 0755));
+	}
+
+	for (i = 0; i < BENCH_HOPS; i++) {
+		if (i + 1 < BENCH_HOPS)
+			TEST_ASSERT_LESS_THAN_INT(sizeof(target), snprintf(target, sizeof(target), "l%d", i + 1));
+		else
+			TEST_ASSERT_LESS_THAN_INT(sizeof(target), snprintf(target, sizeof(target), "d"));
+		TEST_ASSERT_LESS_THAN_INT(sizeof(link), snprintf(link, sizeof(link), "/tmp/rp_bench/l%d", i));
+		if (symlink(target, link) < 0)
+			TEST_FAIL_MESSAGE(strerror(errno));
+	}
+}
+
+
+/* resolves path many times, returns resolutions per second */
+static uint64_t bench_resolve(const char *path, const char *expected)
+{
+	char result[PATH_MAX];
+	uint64_t start;
+	int i;
+
+	start = bench_now();
+	for (i = 0; i < BENCH_ITERS; i++) {
+		if (realpath(path, result) == NULL)
+			TEST_FAIL_MESSAGE(strerror(errno));
+	}
+	start = bench_now() - start;
+
+	TEST_ASSERT_EQUAL_STRING(expected, result);
+
+	return bench_rate(BENCH_ITERS, start);
+}
+
+
+/* realpath throughput for deep paths and symlink chains */
+TEST(resolve_path, bench)
+{
+	char deep[PATH_MAX], path[PATH_MAX];
+	uint64_t rdeep, rdots, rlinks, rmixed;
+	int len;
+
+	bench_mkTree(deep);
+
+	/* all components */
+	rdeep = bench_resolve(deep, deep);
+
+	/* deep path with dot-dot components */
+	len = snprintf(path, sizeof(path), "%s/../../../../d/d/d/./d", deep);
+	TEST_ASSERT_LESS_THAN_INT(sizeof(path), len);
+	rdots = bench_resolve(path, deep);
+
+	/* symlink chain l0 -> l1 -> ... -> d */
+	rlinks = bench_resolve("/tmp/rp_bench/l0", "/tmp/rp_bench/d");
+
+	/* symlink chain followed by deep path */
+	len = snprintf(path, sizeof(path), "/tmp/rp_bench/l0%s", deep + strlen("/tmp/rp_bench/d"));
+	TEST_ASSERT_LESS_THAN_INT(sizeof(path), len);
+	rmixed = bench_resolve(path, deep);
+
+	printf("resolve_path: realpath/s: %d components %" PRIu64 ", with dot-dot %" PRIu64 ", %d symlink hops %" PRIu64 ", hops + components %" PRIu64 "\n",
+		BENCH_DEPTH + 2, rdeep, rdots, BENCH_HOPS, rlinks, rmixed);
+
+	/* retarget symlink in the middle of the chain - result has to follow */
+	TEST_ASSERT_EQUAL_INT(0, unlink("/tmp/rp_bench/l2"));
+	if (symlink("d/d", "/tmp/rp_bench/l2") < 0)
+		TEST_FAIL_MESSAGE(strerror(errno));
+	check_and_free_str("/tmp/rp_bench/d/d", canonicalize_file_name("/tmp/rp_bench/l0"));
+
+	bench_rmTree();
+}
+
+
 TEST_GROUP_RUNNER(resolve_path)
 {
 	RUN_TEST_CASE(resolve_path, canonicalize_abs_simple);
@@ -479,4 +617,6 @@ TEST_GROUP_RUNNER(resolve_path)
 	RUN_TEST_CASE(resolve_path, symlink_dir);
 	RUN_TEST_CASE(resolve_path, symlink_loop);
 	RUN_TEST_CASE(resolve_path, symlink_rename);
+
+	RUN_TEST_CASE(resolve_path, bench);
 }
@@ -0,0 +1,206 @@
+/*
+ * Phoenix-RTOS
+ *
+ * libphoenix
+ *
+ * test/test_contention
+ *
+ * Shared counter contention benchmark - mutexes vs spinlock vs atomics
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/threads.h>
+
+#include "../bench_common.h"
+
+
+#define TEST_TIME   500000 /* Default measurement time per case in usec */
+#define TEST_MAXTHR 8      /* Max number of contending threads */
+
+
+typedef enum { lockMutex = 0, lockPthread, lockSpin, lockAtomic, lockCount } test_lock_t;
+
+
+static const char *test_lockname[] = { "mutexLock", "pthread_mutex", "spinlock", "atomic add" };
+
+
+static struct {
+	test_lock_t lock;
+	volatile int go;
+	volatile int stop;
+	handle_t mutex;
+	pthread_mutex_t pmutex;
+	volatile unsigned char spin;
+	volatile unsigned long counter;
+
+	/* Per thread counters, padded to avoid false sharing */
+	struct {
+		volatile unsigned long ops;
+		char pad[64 - sizeof(unsigned long)];
+	} threads[TEST_MAXTHR] __attribute__((aligned(64)));
+
+	char stacks[TEST_MAXTHR][2048] __attribute__((aligned(8)));
+} test_contention_common;
+
+
+static inline void test_spinLock(volatile unsigned char *spin)
+{
+	while (__atomic_test_and_set(spin, __ATOMIC_ACQUIRE)) {
+		while (*spin)
+			;
+	}
+}
+
+
+static inline void test_spinUnlock(volatile unsigned char *spin)
+{
+	__atomic_clear(spin, __ATOMIC_RELEASE);
+}
+
+
+static void test_contention_thr(void *arg)
+{
+	unsigned int id = (unsigned int)(long)arg;
+	unsigned long ops = 0;
+
+	while (!test_contention_common.go)
+		;
+
+	switch (test_contention_common.lock) {
+		case lockMutex:
+			while (!test_contention_common.stop) {
+				mutexLock(test_contention_common.mutex);
+				test_contention_common.counter++;
+				mutexUnlock(test_contention_common.mutex);
+				ops++;
+			}
+			break;
+
+		case lockPthread:
+			while (!test_contention_common.stop) {
+				pthread_mutex_lock(&test_contention_common.pmutex);
+				test_contention_common.counter++;
+				pthread_mutex_unlock(&test_contention_common.pmutex);
+				ops++;
+			}
+			break;
+
+		case lockSpin:
+			while (!test_contention_common.stop) {
+				test_spinLock(&test_contention_common.spin);
+				test_contention_common.counter++;
+				test_spinUnlock(&test_contention_common.spin);
+				ops++;
+			}
+			break;
+
+		case lockAtomic:
+		default:
+			while (!test_contention_common.stop) {
+				__atomic_fetch_add(&test_contention_common.counter, 1, __ATOMIC_RELAXED);
+				ops++;
+			}
+			break;
+	}
+
+	test_contention_common.threads[id].ops = ops;
+
+	endthread();
+}
+
+
+/* Runs nthreads threads incrementing shared counter for time usec */
+static int test_contention_run(test_lock_t lock, unsigned int nthreads, unsigned int time)
+{
+	unsigned long sum = 0, min = ~0UL, max = 0;
+	unsigned long long sq = 0;
+	unsigned int i, n;
+	uint64_t start, end;
+
+	test_contention_common.lock = lock;
+	test_contention_common.go = 0;
+	test_contention_common.stop = 0;
+	test_contention_common.counter = 0;
+
+	for (n = 0; n < nthreads; n++) {
+		test_contention_common.threads[n].ops = 0;
+		if (beginthread(test_contention_thr, 4, test_contention_common.stacks[n], sizeof(test_contention_common.stacks[n]), (void *)(long)n) < 0)
+			break;
+	}
+
+	start = bench_now();
+	test_contention_common.go = 1;
+	usleep(time);
+	test_contention_common.stop = 1;
+
+	for (i = 0; i < n; i++)
+		threadJoin(0);
+	end = bench_now();
+
+	if (n < nthreads) {
+		printf("test_contention: failed to start %u threads\n", nthreads);
+		return -1;
+	}
+
+	for (i = 0; i < n; i++) {
+		sum += test_contention_common.threads[i].ops;
+		sq += (unsigned long long)test_contention_common.threads[i].ops * test_contention_common.threads[i].ops;
+		if (test_contention_common.threads[i].ops < min)
+			min = test_contention_common.threads[i].ops;
+		if (test_contention_common.threads[i].ops > max)
+			max = test_contention_common.threads[i].ops;
+	}
+
+	/* Jain's fairness index: 100 - all threads did the same number of operations */
+	printf("test_contention: %-14s %7u %12" PRIu64 " %10lu %10lu %8.1f\n", test_lockname[lock], n, bench_rate(sum, end - start), min, max,
+		(sq == 0) ? 0.0 : 100.0 * sum * sum / ((double)n * sq));
+
+	if (test_contention_common.counter != sum) {
+		printf("test_contention: %s counter mismatch: %lu, expected %lu\n", test_lockname[lock], test_contention_common.counter, sum);
+		return -1;
+	}
+
+	return 0;
+}
+
+
+int main(int argc, char *argv[])
+{
+	unsigned int time = (argc > 1) ? strtoul(argv[1], NULL, 10) * 1000 : TEST_TIME;
+	unsigned int nthreads;
+	test_lock_t lock;
+	int err = 0;
+
+	printf("test_contention: starting, %u ms per case\n", time / 1000);
+
+	if ((mutexCreate(&test_contention_common.mutex) != EOK) || (pthread_mutex_init(&test_contention_common.pmutex, NULL) != EOK)) {
+		printf("test_contention: failed to create mutexes\n");
+		return 1;
+	}
+
+	printf("test_contention: %-14s %7s %12s %10s %10s %8s\n", "lock", "threads", "ops/s", "min ops", "max ops", "fairness");
+
+	for (lock = lockMutex; !err && lock < lockCount; lock++) {
+		for (nthreads = 1; nthreads <= TEST_MAXTHR; nthreads <<= 1) {
+			if ((err = test_contention_run(lock, nthreads, time)) < 0)
+				break;
+		}
+	}
+
+	pthread_mutex_destroy(&test_contention_common.pmutex);
+	resourceDestroy(test_contention_common.mutex);
+
+	printf("test_contention: %s\n", err ? "FAILED" : "PASSED");
+
+	return err ? 1 : 0;
+}
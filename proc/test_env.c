@@ -18,6 +18,9 @@
 #include <string.h>
 #include <time.h>
 #include <unistd.h>
+#include <sys/wait.h>
+
+#include "../bench_common.h"
 
 #define NUM_OF_VARIABLES        (64)
 #define NUM_OF_TESTS            (1000)
@@ -27,6 +30,10 @@
 /* Defines how often environment should be cleared (approximately) */
 #define CLEARENV_APPROX_EVERY   (200)
 
+#define BENCH_COUNT             (100)
+#define BENCH_LOOKUPS           (10000)
+#define BENCH_NAME_LEN          (16)
+
 typedef struct {
 	char name[MAX_NAME_LEN];
 	char value[MAX_VALUE_LEN];
@@ -36,15 +43,35 @@ typedef struct {
 
 static env_var_t vars[NUM_OF_VARIABLES];
 
+/* Environment sizes used by the spawn benchmark */
+static const unsigned bench_envsz[] = { 0, 16, 256, 1024, 4096 };
+
+/* Environment sizes used by the getenv/setenv scaling benchmark */
+static const unsigned bench_scalesz[] = { 64, 256, 1024, 4096, 10000 };
+
 static int test_env_random(void);
 static int test_env_exec_start(char *path);
 static int test_env_exec_continue(void);
+static int bench_spawn(char *path, unsigned count);
+static int bench_scale(void);
 
 int main(int argc, char *argv[])
 {
 	int res;
 
-	if (argc == 2 && strcmp(argv[1], "-e") == 0) {
+	if (argc == 2 && strcmp(argv[1], "-q") == 0) {
+		/* Spawn benchmark child - exit immediately */
+		return 0;
+
+	} else if (argc >= 2 && strcmp(argv[1], "-b") == 0) {
+		res = bench_spawn(argv[0], (argc > 2) ? strtoul(argv[2], NULL, 10) : BENCH_COUNT);
+		printf("test_env: spawn benchmark: %s\n", res == 0 ? "PASSED" : "FAILED");
+
+	} else if (argc == 2 && strcmp(argv[1], "-s") == 0) {
+		res = bench_scale();
+		printf("test_env: scaling benchmark: %s\n", res == 0 ? "PASSED" : "FAILED");
+
+	} else if (argc == 2 && strcmp(argv[1], "-e") == 0) {
 		res = test_env_exec_continue();
 		printf("test_env: exec test: %s\n", res == 0 ? "PASSED" : "FAILED");
 
@@ -59,6 +86,30 @@ int main(int argc, char *argv[])
 	return 0;
 }
 
+/* Generates random value of len characters without '=' */
+static void test_env_genvalue(char *value, unsigned len)
+{
+	unsigned j;
+
+	for (j = 0; j < len; j++) {
+		char c;
+		do {
+			c = 33 + rand()%94;
+		} while (c == '\0' || c == '=');
+		value[j] = c;
+	}
+	value[len] = '\0';
+}
+
+/* Initializes variable with VARIABLE<idx> name and random value in "name=value" form */
+static void test_env_genvar(env_var_t *var, unsigned idx)
+{
+	sprintf(var->name, "VARIABLE%u", idx);
+	test_env_genvalue(var->value, rand()%MAX_VALUE_LEN);
+	sprintf(var->s, "%s=%s", var->name, var->value);
+	var->set = 1;
+}
+
 static int test_env_random(void)
 {
 	int res;
@@ -104,16 +155,8 @@ static int test_env_random(void)
 			} else { /* insert (setenv or putenv) */
 
 				/* Generate random value */
-				unsigned len = rand()%MAX_VALUE_LEN;
 				char new_value[MAX_VALUE_LEN];
-				for (j = 0; j < len; j++) {
-					char c;
-					do {
-						c = 33 + rand()%94;
-					} while (c == '\0' || c == '=');
-					new_value[j] = c;
-				}
-				new_value[len] = '\0';
+				test_env_genvalue(new_value, rand()%MAX_VALUE_LEN);
 
 				if (action) { /* setenv */
 					unsigned overwrite = rand()%2;
@@ -199,3 +242,223 @@ static int test_env_exec_continue(void)
 
 	return 0;
 }
+
+/* Spawns child with given method and waits for it, returns -1 on failure */
+static int bench_spawn_one(char *path, char **envp, int exec)
+{
+	char *argv[] = { path, "-q", NULL };
+	int status;
+	pid_t pid;
+
+	if (!exec) {
+		if ((pid = fork()) == 0)
+			_exit(0);
+	}
+	else {
+		if ((pid = vfork()) == 0) {
+			execve(path, argv, envp);
+			_exit(1);
+		}
+	}
+
+	if (pid < 0)
+		return -1;
+
+	if (waitpid(pid, &status, 0) != pid)
+		return -1;
+
+	return (WIFEXITED(status) && WEXITSTATUS(status) == 0) ? 0 : -1;
+}
+
+static int bench_spawn_run(const char *name, unsigned envsz, char *path, char **envp, int exec, unsigned count)
+{
+	bench_stats_t stats;
+	uint64_t start, end, time = 0;
+	unsigned i;
+	char s[64];
+	int res = 0;
+
+	if (bench_statsInit(&stats, count) < 0)
+		return -1;
+
+	for (i = 0; i < count; i++) {
+		start = bench_now();
+		if ((res = bench_spawn_one(path, envp, exec)) < 0) {
+			printf("test_env: spawn benchmark: %s failed\n", name);
+			break;
+		}
+		end = bench_now();
+
+		bench_statsAdd(&stats, end - start);
+		time += end - start;
+	}
+
+	if (res == 0) {
+		bench_statsSort(&stats);
+		sprintf(s, "test_env: %-12s env %4u: %6" PRIu64 " spawns/s", name, envsz, bench_rate(count, time));
+		bench_statsPrint(s, &stats);
+	}
+
+	bench_statsFree(&stats);
+
+	return res;
+}
+
+static int bench_spawn(char *path, unsigned count)
+{
+	const unsigned maxsz = bench_envsz[sizeof(bench_envsz) / sizeof(bench_envsz[0]) - 1];
+	env_var_t *env;
+	char **envp;
+	unsigned i, j;
+	int res;
+
+	printf("test_env: spawn benchmark: %u spawns per case\n", count);
+
+	env = malloc(maxsz * sizeof(*env));
+	envp = malloc((maxsz + 1) * sizeof(*envp));
+
+	if (env == NULL || envp == NULL) {
+		printf("test_env: spawn benchmark: out of memory\n");
+		free(env);
+		free(envp);
+		return -1;
+	}
+
+	srand(time(NULL));
+	for (i = 0; i < maxsz; i++)
+		test_env_genvar(&env[i], i);
+
+	envp[0] = NULL;
+
+	if ((res = bench_spawn_run("fork+exit", 0, path, envp, 0, count)) == 0) {
+		for (i = 0; i < sizeof(bench_envsz) / sizeof(bench_envsz[0]); i++) {
+			for (j = 0; j < bench_envsz[i]; j++)
+				envp[j] = env[j].s;
+			envp[j] = NULL;
+
+			if ((res = bench_spawn_run("vfork+exec", bench_envsz[i], path, envp, 1, count)) < 0)
+				break;
+		}
+	}
+
+	free(envp);
+	free(env);
+
+	return res;
+}
+
+/* Returns per operation time in ns */
+static unsigned bench_nsop(uint64_t time, unsigned ops)
+{
+	return (ops == 0) ? 0 : (unsigned)(time * 1000 / ops);
+}
+
+static int bench_scale(void)
+{
+	const unsigned maxsz = bench_scalesz[sizeof(bench_scalesz) / sizeof(bench_scalesz[0]) - 1];
+	uint64_t start, tset, tget, tmiss, tover, tunset;
+	char (*names)[BENCH_NAME_LEN], value[MAX_VALUE_LEN];
+	unsigned i, j, n, idx;
+	int res = 0;
+	char *v;
+
+	printf("test_env: scaling benchmark: %u lookups per size\n", BENCH_LOOKUPS);
+
+	if ((names = malloc(maxsz * sizeof(*names))) == NULL) {
+		printf("test_env: scaling benchmark: out of memory\n");
+		return -1;
+	}
+
+	srand(time(NULL));
+	for (i = 0; i < maxsz; i++)
+		sprintf(names[i], "VARIABLE%u", i);
+
+	test_env_genvalue(value, MAX_VALUE_LEN - 1);
+
+	printf("test_env: %6s %10s %10s %10s %10s %10s\n", "vars", "setenv", "getenv", "miss", "overwrite", "unsetenv");
+
+	for (i = 0; res == 0 && i < sizeof(bench_scalesz) / sizeof(bench_scalesz[0]); i++) {
+		n = bench_scalesz[i];
+
+		if (clearenv() != 0) {
+			printf("test_env: scaling benchmark: clearenv failed\n");
+			res = -1;
+			break;
+		}
+
+		/* Insert n new variables */
+		start = bench_now();
+		for (j = 0; j < n; j++) {
+			if (setenv(names[j], value, 1) != 0) {
+				printf("test_env: scaling benchmark: setenv(%s) failed\n", names[j]);
+				res = -1;
+				break;
+			}
+		}
+		tset = bench_now() - start;
+
+		if (res != 0)
+			break;
+
+		/* Lookup existing variables */
+		start = bench_now();
+		for (j = 0; j < BENCH_LOOKUPS; j++) {
+			idx = rand() % n;
+			if ((v = getenv(names[idx])) == NULL || v[0] != value[0]) {
+				printf("test_env: scaling benchmark: getenv(%s) returned invalid value\n", names[idx]);
+				res = -1;
+				break;
+			}
+		}
+		tget = bench_now() - start;
+
+		if (res != 0)
+			break;
+
+		/* Lookup missing variable - worst case for linear search */
+		start = bench_now();
+		for (j = 0; res == 0 && j < BENCH_LOOKUPS; j++) {
+			if (getenv("MISSING_VARIABLE") != NULL) {
+				printf("test_env: scaling benchmark: getenv returned value for unset variable\n");
+				res = -1;
+			}
+		}
+		tmiss = bench_now() - start;
+
+		if (res != 0)
+			break;
+
+		/* Overwrite existing variables */
+		start = bench_now();
+		for (j = 0; res == 0 && j < BENCH_LOOKUPS; j++)
+			res = setenv(names[rand() % n], value, 1);
+		tover = bench_now() - start;
+
+		/* Remove all variables */
+		start = bench_now();
+		for (j = 0; res == 0 && j < n; j++)
+			res = unsetenv(names[j]);
+		tunset = bench_now() - start;
+
+		if (res != 0) {
+			printf("test_env: scaling benchmark: setenv/unsetenv failed\n");
+			break;
+		}
+
+		if (environ != NULL && environ[0] != NULL) {
+			printf("test_env: scaling benchmark: environment not empty after unsetenv\n");
+			res = -1;
+			break;
+		}
+
+		printf("test_env: %6u %10u %10u %10u %10u %10u\n", n, bench_nsop(tset, n), bench_nsop(tget, BENCH_LOOKUPS),
+			bench_nsop(tmiss, BENCH_LOOKUPS), bench_nsop(tover, BENCH_LOOKUPS), bench_nsop(tunset, n));
+	}
+
+	if (res == 0)
+		printf("test_env: per operation times in [ns]\n");
+
+	free(names);
+
+	return res;
+}
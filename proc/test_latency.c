@@ -0,0 +1,287 @@
+/*
+ * Phoenix-RTOS
+ *
+ * libphoenix
+ *
+ * test/test_latency
+ *
+ * Thread wakeup, mutex handoff and context switch latency benchmark
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/threads.h>
+
+#include "../bench_common.h"
+
+
+#define TEST_COUNT 1000 /* Default number of measurements per test and priority */
+
+
+/* Tested thread priorities (0 - highest, 7 - lowest) */
+static const unsigned int test_prios[] = { 1, 3, 5, 7 };
+
+
+static struct {
+	handle_t m;
+	handle_t c[2];
+	unsigned int count;
+	volatile unsigned int turn;
+	volatile unsigned int ready;
+	volatile uint64_t ts;
+	uint64_t te;
+	bench_stats_t stats;
+	char stacks[2][4096] __attribute__((aligned(8)));
+} test_latency_common;
+
+
+/*
+ * condSignal -> condWait wakeup latency
+ */
+
+
+static void test_latency_condthr(void *arg)
+{
+	unsigned int i;
+
+	mutexLock(test_latency_common.m);
+	for (i = 0; i < test_latency_common.count; i++) {
+		while (!test_latency_common.turn)
+			condWait(test_latency_common.c[0], test_latency_common.m, 0);
+
+		bench_statsAdd(&test_latency_common.stats, bench_now() - test_latency_common.ts);
+
+		test_latency_common.turn = 0;
+		condSignal(test_latency_common.c[1]);
+	}
+	mutexUnlock(test_latency_common.m);
+
+	endthread();
+}
+
+
+static int test_latency_cond(unsigned int prio)
+{
+	unsigned int i;
+
+	if (beginthread(test_latency_condthr, prio, test_latency_common.stacks[0], sizeof(test_latency_common.stacks[0]), NULL) < 0)
+		return -1;
+
+	/* Give waiter time to block on condition */
+	usleep(10000);
+
+	mutexLock(test_latency_common.m);
+	for (i = 0; i < test_latency_common.count; i++) {
+		test_latency_common.turn = 1;
+		test_latency_common.ts = bench_now();
+		condSignal(test_latency_common.c[0]);
+
+		while (test_latency_common.turn)
+			condWait(test_latency_common.c[1], test_latency_common.m, 0);
+	}
+	mutexUnlock(test_latency_common.m);
+
+	threadJoin(0);
+
+	return 0;
+}
+
+
+/*
+ * mutexUnlock -> blocked mutexLock handoff latency
+ */
+
+
+static void test_latency_mutexthr(void *arg)
+{
+	unsigned int i;
+
+	for (i = 0; i < test_latency_common.count; i++) {
+		while (!test_latency_common.turn)
+			usleep(100);
+
+		/* Mutex is held by the main thread, announce blocking on it */
+		test_latency_common.ready = 1;
+		mutexLock(test_latency_common.m);
+		bench_statsAdd(&test_latency_common.stats, bench_now() - test_latency_common.ts);
+		mutexUnlock(test_latency_common.m);
+
+		test_latency_common.turn = 0;
+	}
+
+	endthread();
+}
+
+
+static int test_latency_mutex(unsigned int prio)
+{
+	unsigned int i;
+
+	if (beginthread(test_latency_mutexthr, prio, test_latency_common.stacks[0], sizeof(test_latency_common.stacks[0]), NULL) < 0)
+		return -1;
+
+	for (i = 0; i < test_latency_common.count; i++) {
+		mutexLock(test_latency_common.m);
+		test_latency_common.turn = 1;
+
+		/*
+		 * Waiter goes from setting ready straight to mutexLock, sleeping after that narrows the window
+		 * in which it's preempted (or on other CPU) before blocking, but doesn't guarantee it's blocked
+		 */
+		while (!test_latency_common.ready)
+			usleep(100);
+		test_latency_common.ready = 0;
+		usleep(1000);
+
+		test_latency_common.ts = bench_now();
+		mutexUnlock(test_latency_common.m);
+
+		while (test_latency_common.turn)
+			usleep(100);
+	}
+
+	threadJoin(0);
+
+	return 0;
+}
+
+
+/*
+ * Context switch cost - two threads of the same priority passing the turn to each other
+ */
+
+
+static void test_latency_switchthr(void *arg)
+{
+	unsigned int i, id = (unsigned int)(long)arg;
+	uint64_t start, now;
+
+	mutexLock(test_latency_common.m);
+	for (i = 0; i < test_latency_common.count; i++) {
+		start = bench_now();
+
+		test_latency_common.turn = !id;
+		condSignal(test_latency_common.c[!id]);
+
+		while (test_latency_common.turn != id)
+			condWait(test_latency_common.c[id], test_latency_common.m, 0);
+
+		/* Round trip consists of two switches */
+		if (id == 0) {
+			now = bench_now();
+			bench_statsAdd(&test_latency_common.stats, now - start);
+
+			/* Threads creation isn't counted, total time starts after the first round trip */
+			if (i == 0)
+				test_latency_common.ts = now;
+			test_latency_common.te = now;
+		}
+	}
+
+	/* Release the other thread */
+	test_latency_common.turn = !id;
+	condSignal(test_latency_common.c[!id]);
+	mutexUnlock(test_latency_common.m);
+
+	endthread();
+}
+
+
+static int test_latency_switch(unsigned int prio, uint64_t *time)
+{
+	test_latency_common.turn = 0;
+
+	if (beginthread(test_latency_switchthr, prio, test_latency_common.stacks[0], sizeof(test_latency_common.stacks[0]), (void *)0) < 0)
+		return -1;
+
+	if (beginthread(test_latency_switchthr, prio, test_latency_common.stacks[1], sizeof(test_latency_common.stacks[1]), (void *)1) < 0) {
+		threadJoin(0);
+		return -1;
+	}
+
+	threadJoin(0);
+	threadJoin(0);
+
+	*time = test_latency_common.te - test_latency_common.ts;
+
+	return 0;
+}
+
+
+int main(int argc, char *argv[])
+{
+	unsigned int i;
+	uint64_t time;
+	char s[64];
+	int err = 0;
+
+	test_latency_common.count = (argc > 1) ? strtoul(argv[1], NULL, 10) : TEST_COUNT;
+
+	printf("test_latency: starting, %u measurements per test\n", test_latency_common.count);
+
+	if ((mutexCreate(&test_latency_common.m) != EOK) || (condCreate(&test_latency_common.c[0]) != EOK) || (condCreate(&test_latency_common.c[1]) != EOK)) {
+		printf("test_latency: failed to create synchronization primitives\n");
+		return 1;
+	}
+
+	if (bench_statsInit(&test_latency_common.stats, test_latency_common.count) < 0) {
+		printf("test_latency: failed to allocate statistics\n");
+		return 1;
+	}
+
+	for (i = 0; !err && i < sizeof(test_prios) / sizeof(test_prios[0]); i++) {
+		test_latency_common.turn = 0;
+		test_latency_common.ready = 0;
+		bench_statsReset(&test_latency_common.stats);
+
+		if ((err = test_latency_cond(test_prios[i])) < 0) {
+			printf("test_latency: cond test failed\n");
+			break;
+		}
+		bench_statsSort(&test_latency_common.stats);
+		sprintf(s, "test_latency: prio %u cond wakeup   ", test_prios[i]);
+		bench_statsPrint(s, &test_latency_common.stats);
+
+		test_latency_common.turn = 0;
+		test_latency_common.ready = 0;
+		bench_statsReset(&test_latency_common.stats);
+
+		if ((err = test_latency_mutex(test_prios[i])) < 0) {
+			printf("test_latency: mutex test failed\n");
+			break;
+		}
+		bench_statsSort(&test_latency_common.stats);
+		sprintf(s, "test_latency: prio %u mutex handoff ", test_prios[i]);
+		bench_statsPrint(s, &test_latency_common.stats);
+
+		bench_statsReset(&test_latency_common.stats);
+
+		if ((err = test_latency_switch(test_prios[i], &time)) < 0) {
+			printf("test_latency: switch test failed\n");
+			break;
+		}
+		bench_statsSort(&test_latency_common.stats);
+		sprintf(s, "test_latency: prio %u switch rtt    ", test_prios[i]);
+		bench_statsPrint(s, &test_latency_common.stats);
+		if (test_latency_common.count > 1)
+			printf("test_latency: prio %u switch cost    %" PRIu64 " [ns]\n", test_prios[i], time * 1000 / (2 * (uint64_t)(test_latency_common.count - 1)));
+	}
+
+	bench_statsFree(&test_latency_common.stats);
+	resourceDestroy(test_latency_common.c[1]);
+	resourceDestroy(test_latency_common.c[0]);
+	resourceDestroy(test_latency_common.m);
+
+	printf("test_latency: %s\n", err ? "FAILED" : "finished");
+
+	return err ? 1 : 0;
+}
@@ -0,0 +1,331 @@
+/*
+ * Phoenix-RTOS
+ *
+ * phoenix-rtos-tests: lock-free queues torture test
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/threads.h>
+
+#include "unity_fixture.h"
+
+#include "../bench_common.h"
+#include "../lfqueue.h"
+
+
+#define QUEUE_SIZE   64    /* Small queue to exercise full/empty conditions */
+#define ITEMS        20000 /* Items pushed by every producer */
+#define MAX_THREADS  4     /* Max number of producers and consumers */
+#define SPIN_TRIES   1000  /* Failed push/pop attempts before sleeping */
+#define ITEM_SEQBITS 20    /* Item sequence number bits, higher bits hold producer id */
+
+
+typedef struct {
+	unsigned int id;
+	unsigned int err;
+	unsigned int count;
+	char stack[4096] __attribute__((aligned(8))); /* stack needs to be aligned to 8 */
+} queue_thread_t;
+
+
+static struct {
+	lfq_spsc_t spsc;
+	lfq_mpmc_t mpmc;
+	unsigned int nproducers;
+	volatile unsigned int consumed;
+	unsigned char *seen;
+	queue_thread_t producers[MAX_THREADS];
+	queue_thread_t consumers[MAX_THREADS];
+} queue_common;
+
+
+static inline void *queue_item(unsigned int producer, unsigned int seq)
+{
+	return (void *)(uintptr_t)((producer << ITEM_SEQBITS) | seq);
+}
+
+
+static void queue_backoff(unsigned int *tries)
+{
+	if (++(*tries) >= SPIN_TRIES) {
+		*tries = 0;
+		usleep(100);
+	}
+}
+
+
+/*
+ * SPSC threads
+ */
+
+
+static void spsc_producer(void *arg)
+{
+	unsigned int i, tries = 0;
+
+	for (i = 0; i < ITEMS; i++) {
+		while (lfq_spscPush(&queue_common.spsc, queue_item(0, i)) < 0)
+			queue_backoff(&tries);
+	}
+
+	endthread();
+}
+
+
+static void spsc_consumer(void *arg)
+{
+	queue_thread_t *self = (queue_thread_t *)arg;
+	unsigned int i, tries = 0;
+	void *item;
+
+	for (i = 0; i < ITEMS; i++) {
+		while (lfq_spscPop(&queue_common.spsc, &item) < 0)
+			queue_backoff(&tries);
+
+		/* Single producer - items have to be received in exactly the same order */
+		if (item != queue_item(0, i))
+			self->err++;
+		self->count++;
+	}
+
+	endthread();
+}
+
+
+/*
+ * MPMC threads
+ */
+
+
+static void mpmc_producer(void *arg)
+{
+	queue_thread_t *self = (queue_thread_t *)arg;
+	unsigned int i, tries = 0;
+
+	for (i = 0; i < ITEMS; i++) {
+		while (lfq_mpmcPush(&queue_common.mpmc, queue_item(self->id, i)) < 0)
+			queue_backoff(&tries);
+		self->count++;
+	}
+
+	endthread();
+}
+
+
+static void mpmc_consumer(void *arg)
+{
+	queue_thread_t *self = (queue_thread_t *)arg;
+	unsigned int last[MAX_THREADS], tries = 0, producer, seq, i;
+	uintptr_t item;
+	void *p;
+
+	for (i = 0; i < MAX_THREADS; i++)
+		last[i] = ~0U;
+
+	while (__atomic_load_n(&queue_common.consumed, __ATOMIC_RELAXED) < queue_common.nproducers * ITEMS) {
+		if (lfq_mpmcPop(&queue_common.mpmc, &p) < 0) {
+			queue_backoff(&tries);
+			continue;
+		}
+		__atomic_add_fetch(&queue_common.consumed, 1, __ATOMIC_RELAXED);
+
+		item = (uintptr_t)p;
+		producer = item >> ITEM_SEQBITS;
+		seq = item & ((1U << ITEM_SEQBITS) - 1);
+
+		if ((producer >= queue_common.nproducers) || (seq >= ITEMS)) {
+			self->err++;
+			continue;
+		}
+
+		/* Items of every producer have to be seen by each consumer in FIFO order */
+		if ((last[producer] != ~0U) && (seq <= last[producer]))
+			self->err++;
+		last[producer] = seq;
+
+		__atomic_add_fetch(&queue_common.seen[producer * ITEMS + seq], 1, __ATOMIC_RELAXED);
+		self->count++;
+	}
+
+	endthread();
+}
+
+
+static void queue_start(queue_thread_t *thr, unsigned int id, void (*fn)(void *))
+{
+	thr->id = id;
+	thr->err = 0;
+	thr->count = 0;
+	TEST_ASSERT_EQUAL_INT(EOK, beginthread(fn, 4, thr->stack, sizeof(thr->stack), thr));
+}
+
+
+static void mpmc_run(unsigned int nproducers, unsigned int nconsumers)
+{
+	unsigned int i, count = 0;
+	uint64_t start, time;
+
+	queue_common.nproducers = nproducers;
+	queue_common.consumed = 0;
+	queue_common.seen = calloc(nproducers * ITEMS, 1);
+	TEST_ASSERT_NOT_NULL(queue_common.seen);
+
+	start = bench_now();
+	for (i = 0; i < nconsumers; i++)
+		queue_start(&queue_common.consumers[i], i, mpmc_consumer);
+	for (i = 0; i < nproducers; i++)
+		queue_start(&queue_common.producers[i], i, mpmc_producer);
+
+	for (i = 0; i < nproducers + nconsumers; i++)
+		threadJoin(0);
+	time = bench_now() - start;
+
+	printf("test_lfqueue: mpmc %u producers %u consumers: %" PRIu64 " items/s\n", nproducers, nconsumers, bench_rate(nproducers * ITEMS, time));
+
+	for (i = 0; i < nconsumers; i++) {
+		TEST_ASSERT_EQUAL_UINT(0, queue_common.consumers[i].err);
+		count += queue_common.consumers[i].count;
+	}
+	TEST_ASSERT_EQUAL_UINT(nproducers * ITEMS, count);
+
+	/* Every item consumed exactly once */
+	for (i = 0; i < nproducers * ITEMS; i++) {
+		if (queue_common.seen[i] != 1)
+			break;
+	}
+	free(queue_common.seen);
+	TEST_ASSERT_EQUAL_UINT(nproducers * ITEMS, i);
+}
+
+
+TEST_GROUP(lfqueue);
+
+
+TEST_SETUP(lfqueue)
+{
+}
+
+
+TEST_TEAR_DOWN(lfqueue)
+{
+}
+
+
+TEST(lfqueue, spsc_basic)
+{
+	unsigned int i;
+	void *item = NULL;
+
+	TEST_ASSERT_EQUAL_INT(-1, lfq_spscInit(&queue_common.spsc, 3));
+	TEST_ASSERT_EQUAL_INT(0, lfq_spscInit(&queue_common.spsc, QUEUE_SIZE));
+
+	TEST_ASSERT_EQUAL_INT(-1, lfq_spscPop(&queue_common.spsc, &item));
+
+	for (i = 0; i < QUEUE_SIZE; i++)
+		TEST_ASSERT_EQUAL_INT(0, lfq_spscPush(&queue_common.spsc, queue_item(0, i)));
+	TEST_ASSERT_EQUAL_INT(-1, lfq_spscPush(&queue_common.spsc, queue_item(0, i)));
+
+	for (i = 0; i < QUEUE_SIZE; i++) {
+		TEST_ASSERT_EQUAL_INT(0, lfq_spscPop(&queue_common.spsc, &item));
+		TEST_ASSERT_EQUAL_PTR(queue_item(0, i), item);
+	}
+	TEST_ASSERT_EQUAL_INT(-1, lfq_spscPop(&queue_common.spsc, &item));
+
+	lfq_spscDone(&queue_common.spsc);
+}
+
+
+TEST(lfqueue, mpmc_basic)
+{
+	unsigned int i, lap;
+	void *item = NULL;
+
+	TEST_ASSERT_EQUAL_INT(-1, lfq_mpmcInit(&queue_common.mpmc, 3));
+	TEST_ASSERT_EQUAL_INT(0, lfq_mpmcInit(&queue_common.mpmc, QUEUE_SIZE));
+
+	/* Several laps to check wrapping of cells sequence numbers */
+	for (lap = 0; lap < 3; lap++) {
+		TEST_ASSERT_EQUAL_INT(-1, lfq_mpmcPop(&queue_common.mpmc, &item));
+
+		for (i = 0; i < QUEUE_SIZE; i++)
+			TEST_ASSERT_EQUAL_INT(0, lfq_mpmcPush(&queue_common.mpmc, queue_item(lap, i)));
+		TEST_ASSERT_EQUAL_INT(-1, lfq_mpmcPush(&queue_common.mpmc, queue_item(lap, i)));
+
+		for (i = 0; i < QUEUE_SIZE; i++) {
+			TEST_ASSERT_EQUAL_INT(0, lfq_mpmcPop(&queue_common.mpmc, &item));
+			TEST_ASSERT_EQUAL_PTR(queue_item(lap, i), item);
+		}
+	}
+
+	lfq_mpmcDone(&queue_common.mpmc);
+}
+
+
+TEST(lfqueue, spsc_stress)
+{
+	uint64_t start, time;
+
+	TEST_ASSERT_EQUAL_INT(0, lfq_spscInit(&queue_common.spsc, QUEUE_SIZE));
+
+	start = bench_now();
+	queue_start(&queue_common.consumers[0], 0, spsc_consumer);
+	queue_start(&queue_common.producers[0], 0, spsc_producer);
+
+	threadJoin(0);
+	threadJoin(0);
+	time = bench_now() - start;
+
+	printf("test_lfqueue: spsc: %" PRIu64 " items/s\n", bench_rate(ITEMS, time));
+
+	lfq_spscDone(&queue_common.spsc);
+
+	TEST_ASSERT_EQUAL_UINT(0, queue_common.consumers[0].err);
+	TEST_ASSERT_EQUAL_UINT(ITEMS, queue_common.consumers[0].count);
+}
+
+
+TEST(lfqueue, mpmc_stress)
+{
+	unsigned int p, c;
+
+	TEST_ASSERT_EQUAL_INT(0, lfq_mpmcInit(&queue_common.mpmc, QUEUE_SIZE));
+
+	for (p = 1; p <= MAX_THREADS; p <<= 1) {
+		for (c = 1; c <= MAX_THREADS; c <<= 1)
+			mpmc_run(p, c);
+	}
+
+	lfq_mpmcDone(&queue_common.mpmc);
+}
+
+
+TEST_GROUP_RUNNER(lfqueue)
+{
+	RUN_TEST_CASE(lfqueue, spsc_basic);
+	RUN_TEST_CASE(lfqueue, mpmc_basic);
+	RUN_TEST_CASE(lfqueue, spsc_stress);
+	RUN_TEST_CASE(lfqueue, mpmc_stress);
+}
+
+
+void runner(void)
+{
+	RUN_TEST_GROUP(lfqueue);
+}
+
+
+int main(int argc, char *argv[])
+{
+	UnityMain(argc, (const char **)argv, runner);
+	return 0;
+}
@@ -21,6 +21,48 @@
 #include "sys/threads.h"
 #include "sys/msg.h"
 
+#include "../bench_common.h"
+
+
+#define TEST_BENCH_COUNT  1000 /* Default number of round trips per message size */
+#define TEST_BENCH_WARMUP 16   /* Number of not measured round trips per message size */
+
+#define TEST_LARGE_COUNT  100 /* Default number of round trips per message size and alignment */
+#define TEST_LARGE_GUARD  0xa5  /* Output buffer guard pattern */
+
+#define TEST_SCALE_COUNT  1000   /* Default number of round trips per client thread */
+#define TEST_SCALE_MAXTHR 8      /* Max number of client and server threads */
+#define TEST_SCALE_MSGSZ  32     /* Scaling test message size */
+#define TEST_SCALE_STOP   0x5707 /* Message type stopping server thread */
+
+
+/* Message sizes used by the benchmark */
+static const unsigned int test_benchsz[] = {
+	0, 1, 32, 128, 512, 1024, 2048, _PAGE_SIZE, 2 * _PAGE_SIZE, 4 * _PAGE_SIZE, 8 * _PAGE_SIZE
+};
+
+
+/* Multi-page message sizes used by the large messages test */
+static const unsigned int test_largesz[] = {
+	_PAGE_SIZE, 2 * _PAGE_SIZE, 3 * _PAGE_SIZE + 123, 4 * _PAGE_SIZE, 8 * _PAGE_SIZE, 16 * _PAGE_SIZE
+};
+
+
+/* Buffer placement cases within page */
+enum { offsAligned = 0, offsEndAligned, offsHalf, offsOdd, offsCount };
+
+
+static const char *test_offsname[] = { "aligned", "end", "half", "odd" };
+
+
+static struct {
+	unsigned port;
+	unsigned count;
+	volatile unsigned err;
+	bench_stats_t stats[TEST_SCALE_MAXTHR];
+	char stacks[2 * TEST_SCALE_MAXTHR][2048] __attribute__((aligned(8)));
+} test_scale_common;
+
 
 unsigned test_randsize(unsigned *seed, unsigned bufsz)
 {
@@ -54,6 +96,26 @@ unsigned test_offset(unsigned *seed, unsigned size, unsigned bufsz)
 }
 
 
+/* Returns buffer offset for a given placement case */
+unsigned test_offsetcase(unsigned c, unsigned size)
+{
+	switch (c) {
+		case offsEndAligned:
+			return (_PAGE_SIZE - (size & (_PAGE_SIZE - 1))) & (_PAGE_SIZE - 1);
+
+		case offsHalf:
+			return _PAGE_SIZE / 2;
+
+		case offsOdd:
+			return 1;
+
+		case offsAligned:
+		default:
+			return 0;
+	}
+}
+
+
 int test_ping(unsigned seed, unsigned port, unsigned count)
 {
 	msg_t msg;
@@ -128,6 +190,381 @@ int test_ping(unsigned seed, unsigned port, unsigned count)
 }
 
 
+/* Measures msgSend round trip latency and bandwidth for increasing message sizes */
+int test_bench(unsigned seed, unsigned port, unsigned count)
+{
+	const unsigned nsizes = sizeof(test_benchsz) / sizeof(test_benchsz[0]);
+	const unsigned bufsz = test_benchsz[nsizes - 1];
+	bench_stats_t stats[sizeof(test_benchsz) / sizeof(test_benchsz[0])];
+	uint64_t time[sizeof(test_benchsz) / sizeof(test_benchsz[0])], start, end;
+	unsigned i, k, s;
+	msg_t msg;
+	void *buf[2];
+	int err = 0;
+
+	printf("test_msg/bench: starting, %u round trips per message size\n", count);
+
+	buf[0] = mmap(NULL, bufsz, PROT_READ | PROT_WRITE, 0, NULL, 0);
+	buf[1] = mmap(NULL, bufsz, PROT_READ | PROT_WRITE, 0, NULL, 0);
+
+	if (buf[0] == NULL || buf[1] == NULL) {
+		printf("test_msg/bench: could not allocate buffers\n");
+		return 1;
+	}
+
+	for (i = 0; i < bufsz; ++i)
+		((unsigned char *)buf[0])[i] = (unsigned char)rand_r(&seed);
+
+	for (s = 0; s < nsizes; ++s) {
+		if (bench_statsInit(&stats[s], count) < 0) {
+			printf("test_msg/bench: could not allocate statistics\n");
+			err = 1;
+			break;
+		}
+
+		memset(buf[1], 0, bufsz);
+		time[s] = 0;
+
+		for (k = 0; k < TEST_BENCH_WARMUP + count; ++k) {
+			memset(&msg, 0, sizeof(msg));
+
+			msg.i.size = msg.o.size = test_benchsz[s];
+			msg.i.data = test_benchsz[s] ? buf[0] : NULL;
+			msg.o.data = test_benchsz[s] ? buf[1] : NULL;
+
+			start = bench_now();
+			if (msgSend(port, &msg) < 0) {
+				printf("test_msg/bench: send failed\n");
+				err = 1;
+				break;
+			}
+			end = bench_now();
+
+			if (msg.o.io.err != 0) {
+				printf("test_msg/bench: pong returned error\n");
+				err = 1;
+				break;
+			}
+
+			if (k >= TEST_BENCH_WARMUP) {
+				bench_statsAdd(&stats[s], end - start);
+				time[s] += end - start;
+			}
+		}
+
+		if (!err && memcmp(buf[0], buf[1], test_benchsz[s])) {
+			printf("test_msg/bench: data mismatch for size %u\n", test_benchsz[s]);
+			err = 1;
+		}
+
+		if (err) {
+			bench_statsFree(&stats[s]);
+			break;
+		}
+
+		bench_statsSort(&stats[s]);
+	}
+
+	/* Print results only at the end, not to disturb measurements */
+	if (!err) {
+		printf("test_msg/bench: %8s %10s %10s %6s %6s %6s %6s %6s\n", "size [B]", "rt/s", "KB/s", "min", "p50", "p90", "p99", "max");
+
+		for (s = 0; s < nsizes; ++s) {
+			/* Data is copied twice per round trip - to the server and back */
+			printf("test_msg/bench: %8u %10" PRIu64 " %10" PRIu64 " %6" PRIu32 " %6" PRIu32 " %6" PRIu32 " %6" PRIu32 " %6" PRIu32 "\n",
+				test_benchsz[s], bench_rate(count, time[s]), bench_rate(2 * (uint64_t)count * test_benchsz[s], time[s]) / 1024,
+				bench_statsPct(&stats[s], 0), bench_statsPct(&stats[s], 50), bench_statsPct(&stats[s], 90), bench_statsPct(&stats[s], 99), bench_statsPct(&stats[s], 100));
+		}
+		printf("test_msg/bench: latencies in [us]\n");
+	}
+
+	while (s--)
+		bench_statsFree(&stats[s]);
+
+	munmap(buf[0], bufsz);
+	munmap(buf[1], bufsz);
+
+	return err;
+}
+
+
+/* Checks that buffer bytes outside of the payload were not modified */
+static int test_guardcheck(const unsigned char *buf, unsigned bufsz, unsigned offs, unsigned size)
+{
+	unsigned i;
+
+	for (i = 0; i < bufsz; ++i) {
+		if ((i == offs) && ((i += size) >= bufsz))
+			break;
+
+		if (buf[i] != TEST_LARGE_GUARD)
+			return -1;
+	}
+
+	return 0;
+}
+
+
+/* Verifies multi-page messages integrity for all buffer placements and measures bandwidth */
+int test_large(unsigned seed, unsigned port, unsigned count)
+{
+	const unsigned nsizes = sizeof(test_largesz) / sizeof(test_largesz[0]);
+	const unsigned bufsz = test_largesz[nsizes - 1] + _PAGE_SIZE;
+	uint64_t time[offsCount][offsCount], start, end, worst;
+	unsigned i, k, s, ic, oc, size, mismatches = 0;
+	unsigned char *in, *out;
+	msg_t msg;
+	void *buf[2];
+
+	printf("test_msg/large: starting, %u round trips per message size and placement\n", count);
+
+	buf[0] = mmap(NULL, bufsz, PROT_READ | PROT_WRITE, 0, NULL, 0);
+	buf[1] = mmap(NULL, bufsz, PROT_READ | PROT_WRITE, 0, NULL, 0);
+
+	if (buf[0] == NULL || buf[1] == NULL) {
+		printf("test_msg/large: could not allocate buffers\n");
+		return 1;
+	}
+
+	printf("test_msg/large: %8s", "size [B]");
+	for (ic = 0; ic < offsCount; ++ic)
+		printf(" %10s", test_offsname[ic]);
+	printf(" %10s\n", "worst");
+
+	for (s = 0; s < nsizes; ++s) {
+		size = test_largesz[s];
+		worst = 0;
+
+		for (ic = 0; ic < offsCount; ++ic) {
+			for (oc = 0; oc < offsCount; ++oc) {
+				in = (unsigned char *)buf[0] + test_offsetcase(ic, size);
+				out = (unsigned char *)buf[1] + test_offsetcase(oc, size);
+				time[ic][oc] = 0;
+
+				for (k = 0; k < count; ++k) {
+					for (i = 0; i < size; ++i)
+						in[i] = (unsigned char)rand_r(&seed);
+					memset(buf[1], TEST_LARGE_GUARD, bufsz);
+
+					memset(&msg, 0, sizeof(msg));
+					msg.i.size = msg.o.size = size;
+					msg.i.data = in;
+					msg.o.data = out;
+
+					start = bench_now();
+					if (msgSend(port, &msg) < 0) {
+						printf("test_msg/large: send failed\n");
+						return 1;
+					}
+					end = bench_now();
+
+					if (msg.o.io.err != 0) {
+						printf("test_msg/large: pong returned error\n");
+						return 1;
+					}
+
+					time[ic][oc] += end - start;
+
+					/* Check payload and guard bytes around it */
+					if (memcmp(in, out, size)) {
+						mismatches++;
+						continue;
+					}
+
+					if (test_guardcheck(buf[1], bufsz, test_offsetcase(oc, size), size) < 0)
+						mismatches++;
+				}
+
+				if ((worst == 0) || (time[ic][oc] > worst))
+					worst = time[ic][oc];
+			}
+		}
+
+		/* Data is copied twice per round trip - to the server and back */
+		printf("test_msg/large: %8u", size);
+		for (ic = 0; ic < offsCount; ++ic)
+			printf(" %10" PRIu64, bench_rate(2 * (uint64_t)count * size, time[ic][ic]) / 1024);
+		printf(" %10" PRIu64 "\n", bench_rate(2 * (uint64_t)count * size, worst) / 1024);
+	}
+
+	printf("test_msg/large: bandwidth in [KB/s] for equal input/output placement, worst of all placements\n");
+
+	munmap(buf[0], bufsz);
+	munmap(buf[1], bufsz);
+
+	if (mismatches) {
+		printf("test_msg/large: %u data mismatches, FAILED\n", mismatches);
+		return 1;
+	}
+
+	printf("test_msg/large: PASSED\n");
+
+	return 0;
+}
+
+
+static void test_scale_server(void *arg)
+{
+	msg_t msg;
+	unsigned long rid;
+	int stop;
+
+	for (;;) {
+		if (msgRecv(test_scale_common.port, &msg, &rid) < 0)
+			continue;
+
+		stop = (msg.type == TEST_SCALE_STOP);
+
+		if (msg.i.size != msg.o.size)
+			msg.o.io.err = 1;
+		else
+			memcpy(msg.o.data, msg.i.data, msg.i.size);
+
+		msgRespond(test_scale_common.port, &msg, rid);
+
+		if (stop)
+			break;
+	}
+
+	endthread();
+}
+
+
+static void test_scale_client(void *arg)
+{
+	unsigned id = (unsigned)(long)arg, k;
+	unsigned char ibuf[TEST_SCALE_MSGSZ], obuf[TEST_SCALE_MSGSZ];
+	uint64_t start, end;
+	msg_t msg;
+
+	memset(ibuf, id, sizeof(ibuf));
+
+	for (k = 0; k < test_scale_common.count; ++k) {
+		memset(&msg, 0, sizeof(msg));
+
+		msg.i.size = msg.o.size = TEST_SCALE_MSGSZ;
+		msg.i.data = ibuf;
+		msg.o.data = obuf;
+
+		start = bench_now();
+		if (msgSend(test_scale_common.port, &msg) < 0 || msg.o.io.err != 0 || memcmp(ibuf, obuf, sizeof(ibuf))) {
+			test_scale_common.err = 1;
+			break;
+		}
+		end = bench_now();
+
+		bench_statsAdd(&test_scale_common.stats[id], end - start);
+	}
+
+	endthread();
+}
+
+
+/* Runs nclients client threads against nservers server threads receiving on the same port */
+static int test_scale_run(unsigned nclients, unsigned nservers, bench_stats_t *total, uint64_t *time)
+{
+	unsigned i, started = 0, servers = 0;
+	uint64_t start;
+	msg_t msg;
+
+	for (i = 0; i < nservers; ++i) {
+		if (beginthread(test_scale_server, 4, test_scale_common.stacks[TEST_SCALE_MAXTHR + i], sizeof(test_scale_common.stacks[0]), NULL) < 0) {
+			test_scale_common.err = 1;
+			break;
+		}
+		servers++;
+	}
+
+	start = bench_now();
+
+	for (i = 0; (i < nclients) && (servers > 0); ++i) {
+		bench_statsReset(&test_scale_common.stats[i]);
+		if (beginthread(test_scale_client, 4, test_scale_common.stacks[i], sizeof(test_scale_common.stacks[0]), (void *)(long)i) < 0) {
+			test_scale_common.err = 1;
+			break;
+		}
+		started++;
+	}
+
+	/* Server threads exit only on stop message, so only clients can be joined until then */
+	for (i = 0; i < started; ++i)
+		threadJoin(0);
+
+	*time = bench_now() - start;
+
+	for (i = 0; i < servers; ++i) {
+		memset(&msg, 0, sizeof(msg));
+		msg.type = TEST_SCALE_STOP;
+		msgSend(test_scale_common.port, &msg);
+		threadJoin(0);
+	}
+
+	bench_statsReset(total);
+	for (i = 0; i < started; ++i)
+		bench_statsMerge(total, &test_scale_common.stats[i]);
+	bench_statsSort(total);
+
+	return test_scale_common.err ? -1 : 0;
+}
+
+
+/* Measures aggregate throughput and tail latency with growing number of clients and servers */
+int test_scale(unsigned count)
+{
+	bench_stats_t total;
+	unsigned i, nclients, nservers;
+	uint64_t time;
+	int err = 0;
+
+	printf("test_msg/scale: starting, %u round trips per client\n", count);
+
+	test_scale_common.count = count;
+	test_scale_common.err = 0;
+
+	if (portCreate(&test_scale_common.port) < 0) {
+		printf("test_msg/scale: could not create port\n");
+		return 1;
+	}
+
+	for (i = 0; i < TEST_SCALE_MAXTHR; ++i) {
+		if (bench_statsInit(&test_scale_common.stats[i], count) < 0)
+			break;
+	}
+
+	if (i < TEST_SCALE_MAXTHR || bench_statsInit(&total, TEST_SCALE_MAXTHR * count) < 0) {
+		printf("test_msg/scale: could not allocate statistics\n");
+		while (i--)
+			bench_statsFree(&test_scale_common.stats[i]);
+		portDestroy(test_scale_common.port);
+		return 1;
+	}
+
+	printf("test_msg/scale: %7s %7s %10s %6s %6s %6s %6s\n", "clients", "servers", "rt/s", "p50", "p90", "p99", "max");
+
+	for (nservers = 1; !err && nservers <= TEST_SCALE_MAXTHR; nservers <<= 1) {
+		for (nclients = 1; nclients <= TEST_SCALE_MAXTHR; nclients <<= 1) {
+			if ((err = test_scale_run(nclients, nservers, &total, &time)) < 0) {
+				printf("test_msg/scale: failed with %u clients and %u servers\n", nclients, nservers);
+				break;
+			}
+
+			printf("test_msg/scale: %7u %7u %10" PRIu64 " %6" PRIu32 " %6" PRIu32 " %6" PRIu32 " %6" PRIu32 "\n", nclients, nservers,
+				bench_rate((uint64_t)nclients * count, time), bench_statsPct(&total, 50), bench_statsPct(&total, 90), bench_statsPct(&total, 99), bench_statsPct(&total, 100));
+		}
+	}
+
+	if (!err)
+		printf("test_msg/scale: latencies in [us]\n");
+
+	bench_statsFree(&total);
+	for (i = 0; i < TEST_SCALE_MAXTHR; ++i)
+		bench_statsFree(&test_scale_common.stats[i]);
+	portDestroy(test_scale_common.port);
+
+	return err ? 1 : 0;
+}
+
+
 int test_pong(unsigned port)
 {
 	msg_t msg;
@@ -160,12 +597,44 @@ int main(int argc, char **argv)
 	oid_t oid;
 	char portname[] = "/tes_tmsg";
 	unsigned count = 0, seed = 123;
-	int err;
+	int err, c, bench = 0, large = 0, scale = 0;
+
+	while ((c = getopt(argc, argv, "bls")) != -1) {
+		switch (c) {
+			case 'b':
+				bench = 1;
+				break;
+
+			case 'l':
+				large = 1;
+				break;
+
+			case 's':
+				scale = 1;
+				break;
+
+			default:
+				printf("Usage: %s [-b | -l | -s] [count] [seed]\n", argv[0]);
+				printf("\t-b - run round trip benchmark against running test_msg server\n");
+				printf("\t-l - run multi-page messages test against running test_msg server\n");
+				printf("\t-s - run multiple clients/servers scaling benchmark on private port\n");
+				return 1;
+		}
+	}
+
+	if (argc > optind)
+		count = strtoul(argv[optind], NULL, 10);
+
+	if (argc > optind + 1)
+		seed = strtoul(argv[optind + 1], NULL, 10);
 
 	/* Wait for console */
 	while (write(1, "", 0) < 0)
 		usleep(10000);
 
+	if (scale)
+		return test_scale(count ? count : TEST_SCALE_COUNT);
+
 	/* Wait for filesystem */
 	while (lookup("/", NULL, &oid) < 0)
 		usleep(10000);
@@ -191,11 +660,11 @@ int main(int argc, char **argv)
 	printf("Found server at %d\n", oid.port);
 	fflush(stdout);
 
-	if (argc > 1)
-		count = strtoul(argv[1], NULL, 10);
+	if (large)
+		return test_large(seed, oid.port, count ? count : TEST_LARGE_COUNT);
 
-	if (argc > 2)
-		seed = strtoul(argv[2], NULL, 10);
+	if (bench)
+		return test_bench(seed, oid.port, count ? count : TEST_BENCH_COUNT);
 
 	return test_ping(seed, oid.port, count);
 }
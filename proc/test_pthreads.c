@@ -16,13 +16,32 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <errno.h>
+#include <string.h>
 #include <unistd.h>
+#include <sys/threads.h>
 #include "pthread.h"
 
+#include "../bench_common.h"
+
 #define TEST_CREATE_JOIN_NUM 100
 #define TEST_MUTEX 5
 #define TEST_EQUAL 2
 
+#define BENCH_NUM      1000 /* Default number of threads created per benchmark */
+#define BENCH_CREATORS 4    /* Max number of concurrent creator threads */
+
+
+/* Benchmarked thread stack sizes */
+static const size_t bench_stacksz[] = { 4096, 16384, 65536 };
+
+
+static struct {
+	volatile unsigned int finished;
+	unsigned int num;
+	size_t stacksz;
+	volatile int err;
+} bench_common;
+
 
 static void *worker(void *arg)
 {
@@ -275,11 +294,221 @@ static int test_pthread_create_detach(int num_threads)
 };
 
 
-int main(void)
+/*
+ * Thread spawn rate benchmarks
+ */
+
+static void *bench_worker(void *arg)
+{
+	__atomic_add_fetch(&bench_common.finished, 1, __ATOMIC_RELEASE);
+
+	return arg;
+}
+
+
+static void bench_nworker(void *arg)
+{
+	__atomic_add_fetch(&bench_common.finished, 1, __ATOMIC_RELEASE);
+
+	endthread();
+}
+
+
+/* Waits until all created threads finish */
+static void bench_wait(unsigned int num)
+{
+	while (__atomic_load_n(&bench_common.finished, __ATOMIC_ACQUIRE) < num)
+		usleep(1000);
+}
+
+
+/* pthread_create + pthread_join */
+static int bench_pthread_join(unsigned int num, size_t stacksz)
+{
+	pthread_attr_t attr;
+	pthread_t thread;
+	unsigned int i;
+	int err = EOK;
+
+	pthread_attr_init(&attr);
+	pthread_attr_setstacksize(&attr, stacksz);
+
+	for (i = 0; i < num; i++) {
+		if ((err = pthread_create(&thread, &attr, bench_worker, NULL)) != EOK)
+			break;
+		if ((err = pthread_join(thread, NULL)) != EOK)
+			break;
+	}
+
+	pthread_attr_destroy(&attr);
+
+	return err;
+}
+
+
+/* pthread_create of detached threads */
+static int bench_pthread_detach(unsigned int num, size_t stacksz)
+{
+	pthread_attr_t attr;
+	pthread_t thread;
+	unsigned int i;
+	int err = EOK;
+
+	pthread_attr_init(&attr);
+	pthread_attr_setstacksize(&attr, stacksz);
+	pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+	bench_common.finished = 0;
+	for (i = 0; i < num; i++) {
+		if ((err = pthread_create(&thread, &attr, bench_worker, NULL)) != EOK)
+			break;
+	}
+	bench_wait(i);
+
+	pthread_attr_destroy(&attr);
+
+	return err;
+}
+
+
+/* beginthread + threadJoin one by one */
+static int bench_native_join(unsigned int num, size_t stacksz)
+{
+	unsigned int i;
+	void *stack;
+	int err = EOK;
+
+	if ((stack = malloc(stacksz)) == NULL)
+		return -ENOMEM;
+
+	for (i = 0; i < num; i++) {
+		if ((err = beginthread(bench_nworker, 4, stack, stacksz, NULL)) < 0)
+			break;
+		threadJoin(0);
+	}
+
+	free(stack);
+
+	return err;
+}
+
+
+/* beginthread of a batch of threads joined afterwards */
+static int bench_native_batch(unsigned int num, size_t stacksz)
+{
+	const unsigned int batch = 16;
+	unsigned int i, j, n;
+	char *stacks;
+	int err = EOK;
+
+	if ((stacks = malloc(batch * stacksz)) == NULL)
+		return -ENOMEM;
+
+	for (i = 0; !err && i < num; i += batch) {
+		for (j = 0, n = 0; j < batch && i + j < num; j++, n++) {
+			if ((err = beginthread(bench_nworker, 4, stacks + j * stacksz, stacksz, NULL)) < 0)
+				break;
+		}
+
+		while (n--)
+			threadJoin(0);
+	}
+
+	free(stacks);
+
+	return err;
+}
+
+
+static void *bench_creator(void *arg)
+{
+	int err;
+
+	if ((err = bench_pthread_join(bench_common.num, bench_common.stacksz)) != EOK)
+		bench_common.err = err;
+
+	return NULL;
+}
+
+
+/* Concurrent pthread_create + pthread_join loops */
+static int bench_concurrent(unsigned int ncreators, unsigned int num, size_t stacksz)
+{
+	pthread_t creators[BENCH_CREATORS];
+	unsigned int i, n;
+
+	bench_common.num = num / ncreators;
+	bench_common.stacksz = stacksz;
+	bench_common.err = EOK;
+
+	for (n = 0; n < ncreators; n++) {
+		if (pthread_create(&creators[n], NULL, bench_creator, NULL) != EOK) {
+			bench_common.err = -EAGAIN;
+			break;
+		}
+	}
+
+	for (i = 0; i < n; i++)
+		pthread_join(creators[i], NULL);
+
+	return bench_common.err;
+}
+
+
+static int bench_threads(unsigned int num)
+{
+	static const struct {
+		const char *name;
+		int (*run)(unsigned int, size_t);
+	} benchs[] = {
+		{ "pthread create+join", bench_pthread_join },
+		{ "pthread create+detach", bench_pthread_detach },
+		{ "beginthread+threadJoin", bench_native_join },
+		{ "beginthread batch of 16", bench_native_batch },
+	};
+	unsigned int i, j, n;
+	uint64_t start, time;
+	int err;
+
+	printf("test_pthreads/bench: starting, %u threads per measurement\n", num);
+	printf("test_pthreads/bench: %-28s %8s %10s\n", "", "stack", "threads/s");
+
+	for (i = 0; i < sizeof(benchs) / sizeof(benchs[0]); i++) {
+		for (j = 0; j < sizeof(bench_stacksz) / sizeof(bench_stacksz[0]); j++) {
+			start = bench_now();
+			if ((err = benchs[i].run(num, bench_stacksz[j])) != EOK) {
+				printf("test_pthreads/bench: %s failed with stack %zu. Error: %d\n", benchs[i].name, bench_stacksz[j], err);
+				return err;
+			}
+			time = bench_now() - start;
+
+			printf("test_pthreads/bench: %-28s %8zu %10" PRIu64 "\n", benchs[i].name, bench_stacksz[j], bench_rate(num, time));
+		}
+	}
+
+	for (n = 1; n <= BENCH_CREATORS; n <<= 1) {
+		start = bench_now();
+		if ((err = bench_concurrent(n, num, bench_stacksz[0])) != EOK) {
+			printf("test_pthreads/bench: %u concurrent creators failed. Error: %d\n", n, err);
+			return err;
+		}
+		time = bench_now() - start;
+
+		printf("test_pthreads/bench: %u concurrent creators       %8zu %10" PRIu64 "\n", n, bench_stacksz[0], bench_rate((num / n) * n, time));
+	}
+
+	return EOK;
+}
+
+
+int main(int argc, char *argv[])
 {
 	int passed = 0;
 	int num_tests = 0;
 
+	if ((argc > 1) && (strcmp(argv[1], "-b") == 0))
+		return bench_threads((argc > 2) ? strtoul(argv[2], NULL, 10) : BENCH_NUM) != EOK;
+
 	printf("test_pthreads: Starting, main is at %p\n\n", main);
 
 	printf("test_pthreads: Testing thread create/join:\n");
@@ -13,12 +13,34 @@
  * %LICENSE%
  */
 
+#include "signal.h"
 #include "stdlib.h"
 #include "stdio.h"
 #include "string.h"
 #include "unistd.h"
 #include "sys/threads.h"
 
+#include "../bench_common.h"
+
+
+#define BENCH_COUNT   100    /* Default number of latency measurements per signal */
+#define BENCH_TIME    1000   /* Default flood time in ms */
+#define BENCH_TIMEOUT 100000 /* Max post -> handler time in usec before signal is considered lost */
+
+
+static struct {
+	volatile uint64_t ts;
+	volatile int measure;
+	volatile unsigned int handled[32];
+	unsigned int posted[32];
+	unsigned int lost[32];
+	unsigned int count;
+	unsigned int time;
+	volatile int done;
+	bench_stats_t stats;
+	char stack[4096] __attribute__((aligned(8)));
+} bench_common;
+
 
 void handler(int s)
 {
@@ -46,8 +68,160 @@ void signaler(void)
 }
 
 
-int main(void)
+/*
+ * Bounded signal delivery benchmark
+ */
+
+
+void bench_handler(int s)
+{
+	if (bench_common.measure) {
+		bench_statsAdd(&bench_common.stats, bench_now() - bench_common.ts);
+		bench_common.measure = 0;
+	}
+
+	bench_common.handled[s]++;
+	signalReturn(s);
+}
+
+
+static int bench_skip(int s)
+{
+	/* Signals which can't be handled */
+	return (s == SIGKILL) || (s == SIGSTOP);
+}
+
+
+/* Waits until handled count of signal s exceeds prev, returns -1 on timeout */
+static int bench_wait(int s, unsigned int prev)
+{
+	uint64_t start = bench_now();
+
+	while (bench_common.handled[s] == prev) {
+		if (bench_now() - start > BENCH_TIMEOUT)
+			return -1;
+		usleep(0);
+	}
+
+	return 0;
+}
+
+
+static void bench_poster(void *arg)
 {
+	int pid = getpid(), s;
+	unsigned int i, prev, total = 0, handled = 0;
+	uint64_t start, end;
+
+	/* Signals should be handled by the main thread */
+	signalMask(0xffffffff, 0xffffffff);
+
+	/* Post -> handler latency, one signal in flight at a time */
+	for (s = 1; s < 32; s++) {
+		if (bench_skip(s))
+			continue;
+
+		for (i = 0; i < bench_common.count; i++) {
+			prev = bench_common.handled[s];
+			bench_common.ts = bench_now();
+			bench_common.measure = 1;
+			signalPost(pid, -1, s);
+
+			if (bench_wait(s, prev) < 0) {
+				bench_common.measure = 0;
+				bench_common.lost[s]++;
+			}
+		}
+	}
+
+	/* Flood - post signals as fast as possible, pending signals of the same number may coalesce */
+	for (s = 1; s < 32; s++)
+		bench_common.handled[s] = 0;
+
+	start = bench_now();
+	for (end = start; end - start < (uint64_t)bench_common.time * 1000; end = bench_now()) {
+		for (s = 1; s < 32; s++) {
+			if (bench_skip(s))
+				continue;
+
+			signalPost(pid, -1, s);
+			bench_common.posted[s]++;
+		}
+	}
+
+	/* Let pending signals be delivered */
+	usleep(BENCH_TIMEOUT);
+
+	for (s = 1; s < 32; s++) {
+		total += bench_common.posted[s];
+		handled += bench_common.handled[s];
+	}
+
+	printf("test_signals/bench: flood: %u posted, %u handled, %" PRIu64 " signals/s\n", total, handled, bench_rate(handled, end - start));
+
+	bench_common.done = 1;
+	endthread();
+}
+
+
+int bench_signals(unsigned int count, unsigned int time)
+{
+	unsigned int lost = 0;
+	int s, failed = 0;
+
+	printf("test_signals/bench: start (%x), %u posts per signal, %u ms flood\n", getpid(), count, time);
+
+	bench_common.count = count;
+	bench_common.time = time;
+
+	if (bench_statsInit(&bench_common.stats, 32 * count) < 0) {
+		printf("test_signals/bench: could not allocate statistics\n");
+		return 1;
+	}
+
+	signalHandle(bench_handler, 0, 0);
+	signalMask(0, 0xffffffff);
+
+	if (beginthread(bench_poster, 4, bench_common.stack, sizeof(bench_common.stack), NULL) < 0) {
+		printf("test_signals/bench: could not start poster thread\n");
+		bench_statsFree(&bench_common.stats);
+		return 1;
+	}
+
+	/* Wait in interruptible sleep for signals */
+	while (!bench_common.done)
+		usleep(10000);
+	threadJoin(0);
+
+	bench_statsSort(&bench_common.stats);
+	bench_statsPrint("test_signals/bench: post -> handler latency", &bench_common.stats);
+
+	printf("test_signals/bench: %6s %8s %8s %8s\n", "signal", "lost", "posted", "handled");
+	for (s = 1; s < 32; s++) {
+		if (bench_skip(s))
+			continue;
+
+		printf("test_signals/bench: %6d %8u %8u %8u\n", s, bench_common.lost[s], bench_common.posted[s], bench_common.handled[s]);
+
+		/* Every signal has to be delivered without losses when posted one by one and at least once during flood */
+		if ((bench_common.lost[s] != 0) || ((bench_common.posted[s] != 0) && (bench_common.handled[s] == 0)))
+			failed++;
+		lost += bench_common.lost[s];
+	}
+
+	bench_statsFree(&bench_common.stats);
+
+	printf("test_signals/bench: %u signals lost, %d signal numbers failed: %s\n", lost, failed, failed ? "FAILED" : "PASSED");
+
+	return failed ? 1 : 0;
+}
+
+
+int main(int argc, char *argv[])
+{
+	if ((argc > 1) && (strcmp(argv[1], "-b") == 0))
+		return bench_signals((argc > 2) ? strtoul(argv[2], NULL, 10) : BENCH_COUNT, (argc > 3) ? strtoul(argv[3], NULL, 10) : BENCH_TIME);
+
 	printf("test_signals: start (%x)\n", getpid());
 
 	if (!fork())
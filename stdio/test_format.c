@@ -0,0 +1,530 @@
+/*
+ * Phoenix-RTOS
+ *
+ * phoenix-rtos-tests: numbers formatting fast paths and throughput
+ *
+ * Integer to decimal/hex conversion with two-digit lookup table and exact fixed-point "%f"
+ * formatting are checked for identical output with libc snprintf and benchmarked against it.
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#include <limits.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "unity_fixture.h"
+
+#include "../bench_common.h"
+
+
+#define FORMAT_BUF   32     /* Formatting buffer size, fits any fast path output */
+#define FORMAT_CALLS 200000 /* Calls per differential test and benchmark */
+#define FORMAT_PREC  6      /* Max fast path "%f" precision */
+
+
+static struct {
+	unsigned int seed;
+	char hex[512]; /* Two hex digits of every byte value */
+} format_common;
+
+
+static const char format_digits[] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+
+static const uint32_t format_pow10[FORMAT_PREC + 1] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+
+
+/* Platform independent pseudo-random numbers generator */
+static unsigned int format_rand(void)
+{
+	format_common.seed = format_common.seed * 1103515245 + 12345;
+	return (format_common.seed >> 16) & 0x7fff;
+}
+
+
+static uint64_t format_rand64(void)
+{
+	uint64_t v = 0;
+	unsigned int i;
+
+	for (i = 0; i < 5; i++)
+		v = (v << 15) | format_rand();
+
+	/* Varying number of digits */
+	return v >> (format_rand() % 64);
+}
+
+
+/* Random double with varying magnitude, half in fast path range */
+static double format_randDouble(void)
+{
+	double v = ldexp((double)(format_rand64() >> 11), (int)(format_rand() % 120) - 100);
+
+	return (format_rand() & 1) ? -v : v;
+}
+
+
+/*
+ * Fast paths
+ */
+
+
+/* Writes v in decimal ending at end, returns first character */
+static char *format_utoa(char *end, uint64_t v)
+{
+	unsigned int d;
+
+	while (v >= 100) {
+		d = (v % 100) * 2;
+		v /= 100;
+		*--end = format_digits[d + 1];
+		*--end = format_digits[d];
+	}
+
+	if (v >= 10) {
+		*--end = format_digits[v * 2 + 1];
+		*--end = format_digits[v * 2];
+	}
+	else {
+		*--end = '0' + v;
+	}
+
+	return end;
+}
+
+
+/* Writes v zero-padded to n decimal digits ending at end */
+static char *format_utoaPad(char *end, uint32_t v, unsigned int n)
+{
+	char *p = format_utoa(end, v);
+
+	while (end - p < (int)n)
+		*--p = '0';
+
+	return p;
+}
+
+
+static int format_copy(char *buf, const char *p, const char *end)
+{
+	size_t n = end - p;
+
+	memmove(buf, p, n);
+	buf[n] = '\0';
+
+	return n;
+}
+
+
+/* snprintf(buf, FORMAT_BUF, "%lld", v) */
+static int format_dec(char *buf, long long v)
+{
+	char tmp[FORMAT_BUF], *end = tmp + sizeof(tmp), *p;
+
+	p = format_utoa(end, (v < 0) ? 0ULL - (unsigned long long)v : (unsigned long long)v);
+	if (v < 0)
+		*--p = '-';
+
+	return format_copy(buf, p, end);
+}
+
+
+static void format_initHex(void)
+{
+	static const char digits[] = "0123456789abcdef";
+	unsigned int i;
+
+	for (i = 0; i < 256; i++) {
+		format_common.hex[2 * i] = digits[i >> 4];
+		format_common.hex[2 * i + 1] = digits[i & 0xf];
+	}
+}
+
+
+/* snprintf(buf, FORMAT_BUF, "%llx", v) */
+static int format_hex(char *buf, unsigned long long v)
+{
+	char tmp[FORMAT_BUF], *end = tmp + sizeof(tmp), *p = end;
+	unsigned int d;
+
+	do {
+		d = (v & 0xff) * 2;
+		*--p = format_common.hex[d + 1];
+		*--p = format_common.hex[d];
+		v >>= 8;
+	} while (v != 0);
+
+	/* Odd number of digits */
+	if ((*p == '0') && (p + 1 < end))
+		p++;
+
+	return format_copy(buf, p, end);
+}
+
+
+/*
+ * snprintf(buf, FORMAT_BUF, "%.*f", prec, v) computed exactly in integers, the fraction f / 2^k
+ * is scaled to f * 10^prec / 2^k in 128 bits (hi:lo), returns -1 for values not below 2^64
+ */
+static int format_fixed(char *buf, double v, unsigned int prec)
+{
+	char tmp[FORMAT_BUF], *end = tmp + sizeof(tmp), *p;
+	uint64_t bits, m, ip = 0, q = 0, lo, hi, t, rlo, rhi, hlo, hhi;
+	int e, k, neg, odd;
+
+	if (prec > FORMAT_PREC)
+		return -1;
+
+	memcpy(&bits, &v, sizeof(bits));
+	neg = bits >> 63;
+	e = (bits >> 52) & 0x7ff;
+	m = bits & ((1ULL << 52) - 1);
+
+	/* Infinities and NaNs */
+	if (e == 0x7ff)
+		return -1;
+
+	/* v = m * 2^(e - 1075), subnormals have implicit exponent 1 */
+	if (e == 0)
+		e = 1;
+	else
+		m |= 1ULL << 52;
+	e -= 1075;
+
+	if (e >= 0) {
+		if (e > 11)
+			return -1;
+		ip = m << e;
+	}
+	/* Values below 2^-75 round to zero for any precision */
+	else if ((k = -e) < 128) {
+		if (k < 64) {
+			ip = m >> k;
+			m &= (1ULL << k) - 1;
+		}
+
+		/* (hi:lo) = m * 10^prec, m < 2^53 */
+		lo = (m & 0xffffffff) * format_pow10[prec];
+		t = (m >> 32) * format_pow10[prec];
+		hi = t >> 32;
+		t <<= 32;
+		lo += t;
+		hi += (lo < t);
+
+		/* q = (hi:lo) >> k, (rhi:rlo) = remainder, (hhi:hlo) = 2^(k - 1) */
+		if (k < 64) {
+			q = (lo >> k) | ((hi << 1) << (63 - k));
+			rhi = 0;
+			rlo = lo & ((1ULL << k) - 1);
+			hhi = 0;
+			hlo = 1ULL << (k - 1);
+		}
+		else {
+			q = hi >> (k - 64);
+			rhi = hi & ((1ULL << (k - 64)) - 1);
+			rlo = lo;
+			hhi = (k > 64) ? 1ULL << (k - 65) : 0;
+			hlo = (k > 64) ? 0 : 1ULL << 63;
+		}
+
+		/* Round half to even like libc in default rounding mode */
+		odd = (prec > 0) ? (q & 1) : (ip & 1);
+		if ((rhi > hhi) || ((rhi == hhi) && ((rlo > hlo) || ((rlo == hlo) && odd)))) {
+			if (++q == format_pow10[prec]) {
+				q = 0;
+				if (++ip == 0)
+					return -1;
+			}
+		}
+	}
+
+	p = end;
+	if (prec > 0) {
+		p = format_utoaPad(p, q, prec);
+		*--p = '.';
+	}
+	p = format_utoa(p, ip);
+	if (neg)
+		*--p = '-';
+
+	return format_copy(buf, p, end);
+}
+
+
+/* snprintf(buf, FORMAT_BUF, "%.*f", prec, v) */
+static int format_float(char *buf, double v, unsigned int prec)
+{
+	int n;
+
+	if ((n = format_fixed(buf, v, prec)) < 0)
+		n = snprintf(buf, FORMAT_BUF, "%.*f", prec, v);
+
+	return n;
+}
+
+
+/*
+ * Differential tests
+ */
+
+
+TEST_GROUP(format);
+
+
+TEST_SETUP(format)
+{
+	format_common.seed = 1;
+}
+
+
+TEST_TEAR_DOWN(format)
+{
+}
+
+
+TEST(format, integers)
+{
+	static const long long vectors[] = {
+		0, 1, -1, 9, 10, 99, 100, 101, 999, 1000, -1000, 65535, 65536, INT_MAX, INT_MIN, UINT_MAX,
+		999999999999LL, 1000000000000LL, 9999999999999999LL, 10000000000000000LL, LLONG_MAX, LLONG_MIN, LLONG_MIN + 1
+	};
+	char buf[FORMAT_BUF], fbuf[FORMAT_BUF];
+	unsigned int i;
+	long long v;
+	int n;
+
+	for (i = 0; i < sizeof(vectors) / sizeof(vectors[0]) + FORMAT_CALLS; i++) {
+		v = (i < sizeof(vectors) / sizeof(vectors[0])) ? vectors[i] : (long long)format_rand64() * ((format_rand() & 1) ? -1 : 1);
+
+		n = snprintf(buf, sizeof(buf), "%lld", v);
+		TEST_ASSERT_EQUAL_INT(n, format_dec(fbuf, v));
+		TEST_ASSERT_EQUAL_STRING(buf, fbuf);
+
+		n = snprintf(buf, sizeof(buf), "%llx", (unsigned long long)v);
+		TEST_ASSERT_EQUAL_INT(n, format_hex(fbuf, v));
+		TEST_ASSERT_EQUAL_STRING(buf, fbuf);
+	}
+}
+
+
+/* Ties, carries, limits and values outside of fast path range for all precisions */
+TEST(format, fixed)
+{
+	static const double vectors[] = {
+		0.0, -0.0, 0.5, 1.5, 2.5, -2.5, 0.125, 0.375, 0.0000005, 0.0000015, 0.0000025, 1e-7, -1e-7, 0.1, 0.2, 0.3,
+		9.5, 9.9999995, 99.999999999, 999999.9999995, 3.14159265358979, 1e15 + 0.5, 4503599627370495.5, 9007199254740993.0,
+		18446744073709549568.0, 18446744073709551616.0, 1e300, 4.9e-324, 2.2250738585072014e-308, INFINITY, -INFINITY, NAN
+	};
+	char buf[FORMAT_BUF], fbuf[FORMAT_BUF];
+	unsigned int i, prec;
+
+	for (i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+		for (prec = 0; prec <= FORMAT_PREC; prec++) {
+			snprintf(buf, sizeof(buf), "%.*f", prec, vectors[i]);
+			format_float(fbuf, vectors[i], prec);
+			TEST_ASSERT_EQUAL_STRING(buf, fbuf);
+
+			/* Fast path covers all finite values below 2^64 */
+			if (isfinite(vectors[i]) && (fabs(vectors[i]) < 18446744073709551616.0))
+				TEST_ASSERT_GREATER_OR_EQUAL_INT(0, format_fixed(fbuf, vectors[i], prec));
+		}
+	}
+}
+
+
+/* Fast path output is identical to libc for random values */
+TEST(format, fixed_generated)
+{
+	char buf[FORMAT_BUF], fbuf[FORMAT_BUF];
+	unsigned int i, prec, fast = 0;
+	double v;
+
+	for (i = 0; i < FORMAT_CALLS; i++) {
+		v = format_randDouble();
+		prec = format_rand() % (FORMAT_PREC + 1);
+
+		snprintf(buf, sizeof(buf), "%.*f", prec, v);
+		if (format_fixed(fbuf, v, prec) >= 0) {
+			TEST_ASSERT_EQUAL_STRING_MESSAGE(buf, fbuf, buf);
+			fast++;
+		}
+	}
+
+	TEST_ASSERT_GREATER_THAN_UINT(FORMAT_CALLS / 2, fast);
+}
+
+
+/* Values with at most 6 decimal digits are parsed back exactly */
+TEST(format, roundtrip)
+{
+	char buf[FORMAT_BUF], fbuf[FORMAT_BUF];
+	unsigned int i;
+	double v;
+
+	for (i = 0; i < FORMAT_CALLS; i++) {
+		/* Exact binary fractions and nearest doubles of decimal fractions */
+		if (i & 1)
+			v = (double)(long long)(format_rand64() >> 11) / 1000000;
+		else
+			v = ldexp((double)(long long)(format_rand64() >> 11), -6);
+		if (format_rand() & 1)
+			v = -v;
+
+		snprintf(buf, sizeof(buf), "%.6f", v);
+		TEST_ASSERT_GREATER_OR_EQUAL_INT(0, format_fixed(fbuf, v, 6));
+		TEST_ASSERT_EQUAL_STRING(buf, fbuf);
+		TEST_ASSERT_TRUE_MESSAGE(strtod(fbuf, NULL) == v, fbuf);
+	}
+}
+
+
+/*
+ * Benchmark
+ */
+
+
+/*
+ * Formats all values with given method, returns calls per second
+ * Methods (libc/fast path): 0/1 - "%d", 2/3 - "%x", 4 - "%s", 5/6 - "%f", 7/8 - "%lld"
+ */
+static uint64_t format_bench(int method, const uint64_t *vals, const double *fvals)
+{
+	static const char *strs[] = { "test", "meterfs", "file_descriptor", "/dev/console" };
+	char buf[FORMAT_BUF];
+	volatile size_t len = 0;
+	unsigned int i;
+	uint64_t start;
+
+	start = bench_now();
+	for (i = 0; i < FORMAT_CALLS; i++) {
+		switch (method) {
+			case 0:
+				len += snprintf(buf, sizeof(buf), "%d", (int)vals[i]);
+				break;
+
+			case 1:
+				len += format_dec(buf, (int)vals[i]);
+				break;
+
+			case 2:
+				len += snprintf(buf, sizeof(buf), "%x", (unsigned int)vals[i]);
+				break;
+
+			case 3:
+				len += format_hex(buf, (unsigned int)vals[i]);
+				break;
+
+			case 4:
+				len += snprintf(buf, sizeof(buf), "%s", strs[vals[i] & 3]);
+				break;
+
+			case 5:
+				len += snprintf(buf, sizeof(buf), "%f", fvals[i]);
+				break;
+
+			case 6:
+				len += format_float(buf, fvals[i], 6);
+				break;
+
+			case 7:
+				len += snprintf(buf, sizeof(buf), "%lld", (long long)vals[i]);
+				break;
+
+			default:
+				len += format_dec(buf, (long long)vals[i]);
+				break;
+		}
+	}
+
+	return bench_rate(FORMAT_CALLS, bench_now() - start);
+}
+
+
+TEST(format, bench)
+{
+	static const struct {
+		const char *name;
+		int libc; /* libc formatting method */
+		int fast; /* Fast path formatting method, -1 if none */
+	} benches[] = {
+		{ "%d", 0, 1 },
+		{ "%x", 2, 3 },
+		{ "%s", 4, -1 },
+		{ "%f", 5, 6 },
+		{ "%lld", 7, 8 },
+	};
+	uint64_t *vals, libc, fast;
+	double *fvals;
+	unsigned int i;
+
+	vals = malloc(FORMAT_CALLS * sizeof(*vals));
+	fvals = malloc(FORMAT_CALLS * sizeof(*fvals));
+	if ((vals == NULL) || (fvals == NULL)) {
+		free(vals);
+		free(fvals);
+		TEST_FAIL_MESSAGE("Out of memory");
+	}
+
+	/* Typical log values: counters, addresses, timestamps and measurements */
+	for (i = 0; i < FORMAT_CALLS; i++) {
+		vals[i] = format_rand64();
+		fvals[i] = (double)(int32_t)format_rand64() / (1 + format_rand());
+	}
+
+	for (i = 0; i < sizeof(benches) / sizeof(benches[0]); i++) {
+		libc = format_bench(benches[i].libc, vals, fvals);
+		if (benches[i].fast < 0) {
+			printf("format: %-4s libc %9" PRIu64 " calls/s\n", benches[i].name, libc);
+		}
+		else {
+			fast = format_bench(benches[i].fast, vals, fvals);
+			printf("format: %-4s libc %9" PRIu64 " calls/s, fast path %9" PRIu64 " calls/s\n", benches[i].name, libc, fast);
+		}
+	}
+
+	free(vals);
+	free(fvals);
+}
+
+
+TEST_GROUP_RUNNER(format)
+{
+	format_initHex();
+
+	RUN_TEST_CASE(format, integers);
+	RUN_TEST_CASE(format, fixed);
+	RUN_TEST_CASE(format, fixed_generated);
+	RUN_TEST_CASE(format, roundtrip);
+	RUN_TEST_CASE(format, bench);
+}
+
+
+void runner(void)
+{
+	RUN_TEST_GROUP(format);
+}
+
+
+int main(int argc, char *argv[])
+{
+	UnityMain(argc, (const char **)argv, runner);
+	return 0;
+}
@@ -0,0 +1,597 @@
+/*
+ * Phoenix-RTOS
+ *
+ * phoenix-rtos-tests: numbers parsing fast paths and throughput
+ *
+ * Table-driven fast paths for strtoll/strtoull, "%d"-only sscanf and dotted-quad inet_addr
+ * are checked against libc (glibc on host-pc, libphoenix on targets) and benchmarked against it.
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#include <errno.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <arpa/inet.h>
+
+#include "unity_fixture.h"
+
+#include "../bench_common.h"
+
+
+#define PARSE_VALUES 200000 /* Generated values per differential test and benchmark */
+#define PARSE_LINE   32     /* Max generated value length (with terminating NUL) */
+
+
+static struct {
+	unsigned char digits[256]; /* Digit value of character, 0xff for non-digits */
+	char *buf;                 /* Generated values, separate strings one after another */
+	unsigned int seed;
+} parse_common;
+
+
+/* Platform independent pseudo-random numbers generator */
+static unsigned int parse_rand(void)
+{
+	parse_common.seed = parse_common.seed * 1103515245 + 12345;
+	return (parse_common.seed >> 16) & 0x7fff;
+}
+
+
+static uint64_t parse_rand64(void)
+{
+	uint64_t v = 0;
+	unsigned int i;
+
+	for (i = 0; i < 5; i++)
+		v = (v << 15) | parse_rand();
+
+	/* Varying number of digits */
+	return v >> (parse_rand() % 64);
+}
+
+
+static void parse_initDigits(void)
+{
+	unsigned int i;
+
+	memset(parse_common.digits, 0xff, sizeof(parse_common.digits));
+	for (i = 0; i < 10; i++)
+		parse_common.digits['0' + i] = i;
+	for (i = 0; i < 26; i++) {
+		parse_common.digits['a' + i] = 10 + i;
+		parse_common.digits['A' + i] = 10 + i;
+	}
+}
+
+
+static inline int parse_isspace(char c)
+{
+	return (c == ' ') || ((c >= '\t') && (c <= '\r'));
+}
+
+
+/*
+ * Fast paths
+ */
+
+
+/* Parses optional sign and digits like strtoull, sets *neg and *over, returns unsigned magnitude (saturated at lim) */
+static unsigned long long parse_digits(const char *s, char **end, int base, unsigned long long lim, int *neg, int *over)
+{
+	const char *p = s;
+	unsigned long long v = 0, cutoff;
+	unsigned int d, cutlim;
+	int any = 0;
+
+	*neg = 0;
+	*over = 0;
+
+	while (parse_isspace(*p))
+		p++;
+
+	if ((*p == '-') || (*p == '+'))
+		*neg = (*p++ == '-');
+
+	if (((base == 0) || (base == 16)) && (p[0] == '0') && ((p[1] == 'x') || (p[1] == 'X')) && (parse_common.digits[(unsigned char)p[2]] < 16)) {
+		p += 2;
+		base = 16;
+	}
+	else if (base == 0) {
+		base = (p[0] == '0') ? 8 : 10;
+	}
+
+	cutoff = lim / base;
+	cutlim = lim % base;
+
+	for (; (d = parse_common.digits[(unsigned char)*p]) < (unsigned int)base; p++) {
+		any = 1;
+		if (*over || (v > cutoff) || ((v == cutoff) && (d > cutlim)))
+			*over = 1;
+		else
+			v = v * base + d;
+	}
+
+	if (end != NULL)
+		*end = (char *)(any ? p : s);
+
+	return any ? v : 0;
+}
+
+
+static long long parse_strtoll(const char *s, char **end, int base)
+{
+	unsigned long long v;
+	int neg, over;
+
+	v = parse_digits(s, end, base, (unsigned long long)LLONG_MAX + 1, &neg, &over);
+
+	if (over || (!neg && (v > LLONG_MAX))) {
+		errno = ERANGE;
+		return neg ? LLONG_MIN : LLONG_MAX;
+	}
+
+	return neg ? (long long)(0ULL - v) : (long long)v;
+}
+
+
+static unsigned long long parse_strtoull(const char *s, char **end, int base)
+{
+	unsigned long long v;
+	int neg, over;
+
+	v = parse_digits(s, end, base, ULLONG_MAX, &neg, &over);
+
+	if (over) {
+		errno = ERANGE;
+		return ULLONG_MAX;
+	}
+
+	return neg ? 0ULL - v : v;
+}
+
+
+/* sscanf(s, "%d", d) for values in int range */
+static int parse_scanInt(const char *s, int *d)
+{
+	unsigned int v = 0, digit;
+	int neg = 0;
+
+	while (parse_isspace(*s))
+		s++;
+
+	if (*s == '\0')
+		return EOF;
+
+	if ((*s == '-') || (*s == '+'))
+		neg = (*s++ == '-');
+
+	if ((digit = (unsigned char)*s - '0') > 9)
+		return 0;
+
+	do {
+		v = v * 10 + digit;
+	} while ((digit = (unsigned char)*++s - '0') <= 9);
+
+	*d = neg ? (int)(0U - v) : (int)v;
+
+	return 1;
+}
+
+
+/* inet_addr() with fast path for plain dotted-quad decimal addresses */
+static in_addr_t parse_inetAddr(const char *s)
+{
+	unsigned char addr[4];
+	unsigned int i, v, n;
+	in_addr_t ret;
+	const char *p = s, *q;
+
+	for (i = 0; i < 4; i++) {
+		for (q = p, v = 0, n = 0; (unsigned int)(*p - '0') <= 9; p++, n++)
+			v = v * 10 + *p - '0';
+
+		/* Leading zeros mean octal numbers */
+		if ((n == 0) || (n > 3) || (v > 255) || ((n > 1) && (*q == '0')))
+			return inet_addr(s);
+
+		addr[i] = v;
+		if (*p++ != ((i < 3) ? '.' : '\0'))
+			return inet_addr(s);
+	}
+
+	memcpy(&ret, addr, sizeof(ret));
+
+	return ret;
+}
+
+
+/*
+ * Differential tests
+ */
+
+
+static const struct {
+	const char *str;
+	int base;
+} parse_vectors[] = {
+	/* test_str2num vectors */
+	{ "-100", 10 }, { "100", 10 }, { "-2000000000", 10 }, { "2000000000", 10 },
+	{ "-9000000000000000000", 10 }, { "9000000000000000000", 10 },
+	{ "40000", 10 }, { "4000000000", 10 }, { "18000000000000000000", 10 },
+	/* Limits and overflows */
+	{ "9223372036854775807", 10 }, { "9223372036854775808", 10 }, { "-9223372036854775808", 10 }, { "-9223372036854775809", 10 },
+	{ "18446744073709551615", 10 }, { "18446744073709551616", 10 }, { "ffffffffffffffff", 16 }, { "1ffffffffffffffff", 16 },
+	{ "-1", 10 }, { "-0", 10 }, { "99999999999999999999999999", 10 },
+	/* Prefixes, bases and partial input */
+	{ "  +42abc", 10 }, { "\t\n 12", 10 }, { "0x1f", 0 }, { "0x1f", 16 }, { "0X1F", 16 }, { "0x", 16 }, { "0x", 0 }, { "0xg", 0 },
+	{ "017", 0 }, { "019", 0 }, { "z", 36 }, { "Zz", 36 }, { "101", 2 }, { "2", 2 },
+	/* No digits */
+	{ "", 10 }, { "-", 10 }, { "+", 10 }, { "   ", 10 }, { "abc", 10 }, { "- 1", 10 },
+};
+
+
+/* Single sscanf conversion with expected glibc result */
+static const struct {
+	const char *str;
+	const char *fmt;
+	int ret;
+	long long val;
+} parse_scanf[] = {
+	/* test_scanf vectors */
+	{ "1234565432100", "%lld", 1, 1234565432100LL },
+	{ "-12345654321", "%lld", 1, -12345654321LL },
+	{ "0xbeefbabe dum", "%x", 1, 0xbeefbabe },
+	{ "01234567 bom", "%o", 1, 01234567 },
+	{ "51242 bla", "%d", 1, 51242 },
+	{ "+123 1261231241234", "%d", 1, 123 },
+	{ "5534-1234", "%hd", 1, 5534 },
+	{ "deadbeef12345678deadc0de", "%8x", 1, 0xdeadbeef },
+	{ "12345678a1234567", "%8d", 1, 12345678 },
+	{ "!@%SFDS@#$", "%8d", 0, 0 },
+	{ "$#&$%&%$@#^#$^&%$^@#$", "%d", 0, 0 },
+	{ "\xc4\x85\xc4\x99\xc5\x9b\xc4\x87", "%d", 0, 0 },
+	{ "\xff\xff\xff\xff\xff\xff", "%d", 0, 0 },
+	/* %d fast path corner cases */
+	{ "   -77 rest", "%d", 1, -77 },
+	{ "\n\t2147483647", "%d", 1, 2147483647 },
+	{ "-2147483648", "%d", 1, -2147483647LL - 1 },
+	{ "-", "%d", 0, 0 },
+	{ "+x", "%d", 0, 0 },
+	{ "", "%d", EOF, 0 },
+	{ "   ", "%d", EOF, 0 },
+	{ "0x1A", "%i", 1, 26 },
+	{ "017", "%i", 1, 15 },
+};
+
+
+static const struct {
+	const char *str;
+	in_addr_t addr; /* In host byte order */
+} parse_inet[] = {
+	/* test_str2num vectors */
+	{ "127.0.0.1", 0x7f000001 },
+	{ "127.1", 0x7f000001 },
+	{ "192.168.0.1", 0xc0a80001 },
+	{ "192.168.0x1", 0xc0a80001 },
+	{ "0xc0a80001", 0xc0a80001 },
+	/* Fast path corner cases */
+	{ "255.255.255.254", 0xfffffffe },
+	{ "0.0.0.0", 0 },
+	{ "010.0.0.1", 0x08000001 },
+	{ "1.2.3.4.5", INADDR_NONE },
+	{ "256.1.1.1", INADDR_NONE },
+	{ "1.2.3.", INADDR_NONE },
+	{ "1..2.3", INADDR_NONE },
+};
+
+
+TEST_GROUP(parse);
+
+
+TEST_SETUP(parse)
+{
+	parse_common.seed = 1;
+}
+
+
+TEST_TEAR_DOWN(parse)
+{
+	free(parse_common.buf);
+	parse_common.buf = NULL;
+}
+
+
+/* Fast paths give the same results, end pointers and errors as libc */
+TEST(parse, strtoll)
+{
+	char *end, *fend;
+	unsigned int i;
+	long long v, fv;
+	unsigned long long u, fu;
+	int err;
+
+	for (i = 0; i < sizeof(parse_vectors) / sizeof(parse_vectors[0]); i++) {
+		errno = 0;
+		v = strtoll(parse_vectors[i].str, &end, parse_vectors[i].base);
+		err = errno;
+		errno = 0;
+		fv = parse_strtoll(parse_vectors[i].str, &fend, parse_vectors[i].base);
+
+		TEST_ASSERT_EQUAL_INT64_MESSAGE(v, fv, parse_vectors[i].str);
+		TEST_ASSERT_EQUAL_PTR_MESSAGE(end, fend, parse_vectors[i].str);
+		TEST_ASSERT_EQUAL_INT_MESSAGE(err, errno, parse_vectors[i].str);
+
+		errno = 0;
+		u = strtoull(parse_vectors[i].str, &end, parse_vectors[i].base);
+		err = errno;
+		errno = 0;
+		fu = parse_strtoull(parse_vectors[i].str, &fend, parse_vectors[i].base);
+
+		TEST_ASSERT_EQUAL_UINT64_MESSAGE(u, fu, parse_vectors[i].str);
+		TEST_ASSERT_EQUAL_PTR_MESSAGE(end, fend, parse_vectors[i].str);
+		TEST_ASSERT_EQUAL_INT_MESSAGE(err, errno, parse_vectors[i].str);
+	}
+}
+
+
+/* libc sscanf matches glibc results, "%d" fast path matches libc */
+TEST(parse, sscanf)
+{
+	unsigned int i, x;
+	long long lld;
+	short hd;
+	int ret, d, fd;
+
+	for (i = 0; i < sizeof(parse_scanf) / sizeof(parse_scanf[0]); i++) {
+		d = 0;
+		x = 0;
+		lld = 0;
+		hd = 0;
+
+		if (strcmp(parse_scanf[i].fmt, "%lld") == 0) {
+			ret = sscanf(parse_scanf[i].str, parse_scanf[i].fmt, &lld);
+		}
+		else if (strcmp(parse_scanf[i].fmt, "%hd") == 0) {
+			ret = sscanf(parse_scanf[i].str, parse_scanf[i].fmt, &hd);
+			lld = hd;
+		}
+		else if ((strchr(parse_scanf[i].fmt, 'x') != NULL) || (strchr(parse_scanf[i].fmt, 'o') != NULL)) {
+			ret = sscanf(parse_scanf[i].str, parse_scanf[i].fmt, &x);
+			lld = x;
+		}
+		else {
+			ret = sscanf(parse_scanf[i].str, parse_scanf[i].fmt, &d);
+			lld = d;
+		}
+
+		TEST_ASSERT_EQUAL_INT_MESSAGE(parse_scanf[i].ret, ret, parse_scanf[i].str);
+		if (ret == 1)
+			TEST_ASSERT_EQUAL_INT64_MESSAGE(parse_scanf[i].val, lld, parse_scanf[i].str);
+
+		if (strcmp(parse_scanf[i].fmt, "%d") == 0) {
+			fd = 0;
+			TEST_ASSERT_EQUAL_INT_MESSAGE(ret, parse_scanInt(parse_scanf[i].str, &fd), parse_scanf[i].str);
+			TEST_ASSERT_EQUAL_INT_MESSAGE(d, fd, parse_scanf[i].str);
+		}
+	}
+}
+
+
+TEST(parse, inet)
+{
+	unsigned int i;
+
+	for (i = 0; i < sizeof(parse_inet) / sizeof(parse_inet[0]); i++) {
+		TEST_ASSERT_EQUAL_HEX32_MESSAGE(htonl(parse_inet[i].addr), inet_addr(parse_inet[i].str), parse_inet[i].str);
+		TEST_ASSERT_EQUAL_HEX32_MESSAGE(inet_addr(parse_inet[i].str), parse_inetAddr(parse_inet[i].str), parse_inet[i].str);
+	}
+}
+
+
+/* Generates PARSE_VALUES values with given format: 0 - decimal, 1 - hex, 2 - int, 3 - float, 4 - IPv4 address */
+static void parse_generate(int type)
+{
+	unsigned int i;
+	uint64_t v;
+	char *p;
+
+	parse_common.buf = malloc(PARSE_VALUES * PARSE_LINE);
+	TEST_ASSERT_NOT_NULL(parse_common.buf);
+
+	for (i = 0, p = parse_common.buf; i < PARSE_VALUES; i++, p++) {
+		v = parse_rand64();
+
+		switch (type) {
+			case 0:
+				p += sprintf(p, "%lld", (parse_rand() & 1) ? -(long long)(v >> 1) : (long long)(v >> 1));
+				break;
+
+			case 1:
+				p += sprintf(p, "%llx", (unsigned long long)v);
+				break;
+
+			case 2:
+				p += sprintf(p, "%d", (int)(int32_t)v);
+				break;
+
+			case 3:
+				p += sprintf(p, "%.9g", (double)(int64_t)v / (1 + parse_rand()));
+				break;
+
+			default:
+				p += sprintf(p, "%u.%u.%u.%u", (unsigned int)(v >> 24) & 0xff, (unsigned int)(v >> 16) & 0xff, (unsigned int)(v >> 8) & 0xff, (unsigned int)v & 0xff);
+				break;
+		}
+	}
+}
+
+
+/* Fast paths agree with libc on generated values */
+TEST(parse, generated)
+{
+	char *p, *end, *fend;
+	unsigned int i;
+	int d, fd;
+
+	parse_generate(0);
+	for (i = 0, p = parse_common.buf; i < PARSE_VALUES; i++, p = end + 1) {
+		TEST_ASSERT_EQUAL_INT64(strtoll(p, &end, 10), parse_strtoll(p, &fend, 10));
+		TEST_ASSERT_EQUAL_PTR(end, fend);
+	}
+	free(parse_common.buf);
+
+	parse_generate(1);
+	for (i = 0, p = parse_common.buf; i < PARSE_VALUES; i++, p = end + 1) {
+		TEST_ASSERT_EQUAL_UINT64(strtoull(p, &end, 16), parse_strtoull(p, &fend, 16));
+		TEST_ASSERT_EQUAL_PTR(end, fend);
+	}
+	free(parse_common.buf);
+
+	parse_generate(2);
+	for (i = 0, p = parse_common.buf; i < PARSE_VALUES; i++, p += strlen(p) + 1) {
+		TEST_ASSERT_EQUAL_INT(sscanf(p, "%d", &d), parse_scanInt(p, &fd));
+		TEST_ASSERT_EQUAL_INT(d, fd);
+	}
+	free(parse_common.buf);
+
+	parse_generate(4);
+	for (i = 0, p = parse_common.buf; i < PARSE_VALUES; i++, p += strlen(p) + 1)
+		TEST_ASSERT_EQUAL_HEX32(inet_addr(p), parse_inetAddr(p));
+}
+
+
+/*
+ * Benchmark
+ */
+
+
+/*
+ * Parses all generated values with given method, returns values per second
+ * Methods (libc/fast path): 0/1 - strtoll, 2/3 - strtoull, 4/5 - sscanf "%d", 6 - strtod, 7/8 - inet_addr
+ */
+static uint64_t parse_bench(int method)
+{
+	unsigned int i;
+	uint64_t start;
+	volatile uint64_t sum = 0;
+	char *p, *end;
+	volatile double f = 0;
+	int d;
+
+	start = bench_now();
+	for (i = 0, p = parse_common.buf; i < PARSE_VALUES; i++, p = end + 1) {
+		switch (method) {
+			case 0:
+				sum += strtoll(p, &end, 10);
+				break;
+
+			case 1:
+				sum += parse_strtoll(p, &end, 10);
+				break;
+
+			case 2:
+				sum += strtoull(p, &end, 16);
+				break;
+
+			case 3:
+				sum += parse_strtoull(p, &end, 16);
+				break;
+
+			case 4:
+				sscanf(p, "%d", &d);
+				sum += d;
+				end = strchr(p, '\0');
+				break;
+
+			case 5:
+				parse_scanInt(p, &d);
+				sum += d;
+				end = strchr(p, '\0');
+				break;
+
+			case 6:
+				f += strtod(p, &end);
+				break;
+
+			case 7:
+				end = strchr(p, '\0');
+				sum += inet_addr(p);
+				break;
+
+			default:
+				end = strchr(p, '\0');
+				sum += parse_inetAddr(p);
+				break;
+		}
+	}
+
+	return bench_rate(PARSE_VALUES, bench_now() - start);
+}
+
+
+TEST(parse, bench)
+{
+	static const struct {
+		const char *name;
+		int type; /* Generated values format */
+		int libc; /* libc parsing method */
+		int fast; /* Fast path parsing method, -1 if none */
+	} benches[] = {
+		{ "strtoll", 0, 0, 1 },
+		{ "strtoull", 1, 2, 3 },
+		{ "sscanf", 2, 4, 5 },
+		{ "strtod", 3, 6, -1 },
+		{ "inet", 4, 7, 8 },
+	};
+	uint64_t libc, fast;
+	unsigned int i;
+
+	for (i = 0; i < sizeof(benches) / sizeof(benches[0]); i++) {
+		parse_generate(benches[i].type);
+
+		libc = parse_bench(benches[i].libc);
+		if (benches[i].fast < 0) {
+			printf("parse: %-8s libc %9" PRIu64 " values/s\n", benches[i].name, libc);
+		}
+		else {
+			fast = parse_bench(benches[i].fast);
+			printf("parse: %-8s libc %9" PRIu64 " values/s, fast path %9" PRIu64 " values/s\n", benches[i].name, libc, fast);
+		}
+
+		free(parse_common.buf);
+		parse_common.buf = NULL;
+	}
+}
+
+
+TEST_GROUP_RUNNER(parse)
+{
+	parse_initDigits();
+
+	RUN_TEST_CASE(parse, strtoll);
+	RUN_TEST_CASE(parse, sscanf);
+	RUN_TEST_CASE(parse, inet);
+	RUN_TEST_CASE(parse, generated);
+	RUN_TEST_CASE(parse, bench);
+}
+
+
+void runner(void)
+{
+	RUN_TEST_GROUP(parse);
+}
+
+
+int main(int argc, char *argv[])
+{
+	UnityMain(argc, (const char **)argv, runner);
+	return 0;
+}
@@ -12,10 +12,68 @@
  */
 
 #include <errno.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <sys/interrupt.h>
+#include <sys/mman.h>
+#include <sys/threads.h>
 
 #include <virtio.h>
 
+#include "../bench_common.h"
+#include "vring.h"
+
+
+#define TEST_QSIZE 128 /* Benchmark virtqueue size */
+#define TEST_DEPTH 32  /* Max number of requests in flight (max batch size) */
+#define TEST_BLKSZ 512 /* Block device request data size */
+#define TEST_RNGSZ 64  /* Entropy source request data size */
+#define TEST_TIMEO 3   /* Max time without completed requests in seconds */
+
+#define TEST_F_EVENT_IDX (1ULL << 29) /* VIRTIO_F_EVENT_IDX feature bit */
+
+#define TEST_DEVS    32 /* Max number of probed devices */
+#define TEST_THREADS 8  /* Max number of device initialization threads */
+
+
+/* Benchmark request, fits in single page so its buffers are physically contiguous */
+typedef struct {
+	virtio_req_t vreq;
+	virtio_seg_t segs[3];
+
+	/* Block device request header */
+	struct {
+		uint32_t type;
+		uint32_t reserved;
+		uint64_t sector;
+	} hdr;
+	uint8_t data[TEST_BLKSZ];
+	uint8_t status;
+} test_req_t;
+
+
+static struct {
+	virtio_dev_t *vdev;            /* Benchmarked device */
+	virtqueue_t vq;                /* Benchmarked virtqueue */
+	handle_t lock;
+	handle_t cond;
+	handle_t inth;
+	volatile unsigned int irqs;    /* Number of device interrupts */
+	int eventidx;                  /* Notifications suppression with event indexes */
+	test_req_t *reqs[TEST_DEPTH];
+
+	/* Probed devices */
+	virtio_dev_t devs[TEST_DEVS];
+	void *base[TEST_DEVS];         /* Device base address before initialization */
+	int err[TEST_DEVS];            /* Device initialization status, 1 if initialization was deferred */
+	unsigned int ndevs;
+	unsigned int next;             /* Next device to initialize */
+	uint32_t classes;              /* Initialized device types, bit per type ID */
+} test_virtio_common;
+
 
 /* VirtIO device descriptors */
 static const virtio_devinfo_t info[] = {
@@ -133,7 +191,8 @@ static const char *name[] = {
 };
 
 
-static const char *test_virtio_name(virtio_dev_t *vdev, char *buff)
+/* Returns device type ID (0 for unknown devices) */
+static unsigned int test_virtio_id(virtio_dev_t *vdev)
 {
 	unsigned int id = vdev->info.id;
 
@@ -161,7 +220,18 @@ static const char *test_virtio_name(virtio_dev_t *vdev, char *buff)
 		id -= 0x1040;
 	}
 
-	if (!id || (id > 0x0d && id < 0x10) || (id > 0x18)) {
+	if ((id > 0x0d && id < 0x10) || (id > 0x18))
+		return 0;
+
+	return id;
+}
+
+
+static const char *test_virtio_name(virtio_dev_t *vdev, char *buff)
+{
+	unsigned int id = test_virtio_id(vdev);
+
+	if (!id) {
 		sprintf(buff, "unknown VirtIO device");
 		return buff;
 	}
@@ -174,21 +244,262 @@ static const char *test_virtio_name(virtio_dev_t *vdev, char *buff)
 };
 
 
-/* Detects and initializes all VirtIO devices in the system */
-static void test_virtio_init(void)
+/*
+ * Virtqueue throughput benchmark
+ */
+
+
+static int test_virtio_intr(unsigned int n, void *arg)
+{
+	/* Used buffer notification */
+	if (!(virtio_isr(test_virtio_common.vdev) & 0x1))
+		return -1;
+
+	test_virtio_common.irqs++;
+
+	return 1;
+}
+
+
+/* Prepares n-th request for block (0x02) or entropy source (0x04) device, returns request data size */
+static unsigned int test_virtio_prep(test_req_t *req, unsigned int id, unsigned int n, uint64_t sectors)
+{
+	unsigned int i;
+
+	if (id == 0x02) {
+		req->hdr.type = 0; /* VIRTIO_BLK_T_IN */
+		req->hdr.reserved = 0;
+		req->hdr.sector = n % sectors;
+		req->status = 0xff;
+
+		req->segs[0].buff = &req->hdr;
+		req->segs[0].len = sizeof(req->hdr);
+		req->segs[1].buff = req->data;
+		req->segs[1].len = TEST_BLKSZ;
+		req->segs[2].buff = &req->status;
+		req->segs[2].len = sizeof(req->status);
+		req->vreq.rsegs = 1;
+		req->vreq.wsegs = 2;
+	}
+	else {
+		req->segs[0].buff = req->data;
+		req->segs[0].len = TEST_RNGSZ;
+		req->vreq.rsegs = 0;
+		req->vreq.wsegs = 1;
+	}
+
+	/* Segments form circular list */
+	req->vreq.segs = req->segs;
+	for (i = 0; i < req->vreq.rsegs + req->vreq.wsegs; i++) {
+		req->segs[i].next = &req->segs[(i + 1) % (req->vreq.rsegs + req->vreq.wsegs)];
+		req->segs[(i + 1) % (req->vreq.rsegs + req->vreq.wsegs)].prev = &req->segs[i];
+	}
+
+	return req->segs[(id == 0x02) ? 1 : 0].len;
+}
+
+
+/* Pushes n requests through virtqueue in batches, notifying device once per batch */
+static int test_virtio_run(unsigned int id, unsigned int n, unsigned int batch, uint64_t sectors)
+{
+	virtio_dev_t *vdev = test_virtio_common.vdev;
+	virtqueue_t *vq = &test_virtio_common.vq;
+	unsigned int i, k, done = 0, kicks = 0, irqs, len, size = 0;
+	uint64_t bytes = 0, start, end, progress;
+	test_req_t *req;
+	uint16_t old;
+	int err = EOK;
+
+	irqs = test_virtio_common.irqs;
+	start = bench_now();
+
+	mutexLock(test_virtio_common.lock);
+	while ((err == EOK) && (done < n)) {
+		k = (n - done < batch) ? n - done : batch;
+		old = vq->avail->idx;
+
+		for (i = 0; i < k; i++) {
+			size = test_virtio_prep(test_virtio_common.reqs[i], id, done + i, sectors);
+			if ((err = virtqueue_enqueue(vdev, vq, &test_virtio_common.reqs[i]->vreq)) < 0)
+				break;
+		}
+
+		if (i == 0)
+			break;
+
+		if (test_virtio_common.eventidx) {
+			/* Single interrupt after whole batch completes */
+			*vq->uevent = vq->last + i - 1;
+			vring_barrier();
+
+			/* Notify only if device waits for buffers we've just added */
+			if (vring_needEvent(*vq->aevent, vq->avail->idx, old)) {
+				virtqueue_notify(vdev, vq);
+				kicks++;
+			}
+		}
+		else {
+			virtqueue_notify(vdev, vq);
+			kicks++;
+		}
+
+		/* Wait for whole batch */
+		for (k = i, progress = bench_now(); k > 0;) {
+			if ((req = virtqueue_dequeue(vdev, vq, &len)) == NULL) {
+				/* Device stopped completing requests */
+				if (bench_now() - progress > TEST_TIMEO * 1000000ULL) {
+					err = -ETIME;
+					break;
+				}
+				condWait(test_virtio_common.cond, test_virtio_common.lock, 1000);
+				continue;
+			}
+			progress = bench_now();
+
+			if ((id == 0x02) && (req->status != 0)) {
+				err = -EIO;
+			}
+			else {
+				bytes += size;
+				done++;
+			}
+			k--;
+		}
+	}
+	mutexUnlock(test_virtio_common.lock);
+
+	end = bench_now();
+	irqs = test_virtio_common.irqs - irqs;
+
+	if (err < 0)
+		return err;
+
+	printf("test_virtio: %5u %10" PRIu64 " %10" PRIu64 " %10u %10u\n", batch, bench_rate(done, end - start), bench_rate(bytes, end - start) >> 10,
+		(unsigned int)((uint64_t)kicks * 1000 / done), (unsigned int)((uint64_t)irqs * 1000 / done));
+
+	return EOK;
+}
+
+
+/* Measures request rate, throughput and notifications per request of initialized block or entropy source device */
+static int test_virtio_bench(virtio_dev_t *vdev, unsigned int id, unsigned int n, int eventidx)
+{
+	static const unsigned int batches[] = { 1, 4, 16, TEST_DEPTH };
+	uint64_t sectors = 0, features;
+	unsigned int i;
+	int err;
+
+	if (id == 0x02) {
+		/* Read only the first 1 MB to keep data in host cache */
+		if ((sectors = virtio_readConfig64(vdev, 0)) == 0)
+			return -ENODEV;
+		if (sectors > (1 << 20) / TEST_BLKSZ)
+			sectors = (1 << 20) / TEST_BLKSZ;
+	}
+
+	/* Modern devices require VIRTIO_F_VERSION_1 */
+	features = virtio_legacy(vdev) ? 0 : (1ULL << 32);
+	if (eventidx && (virtio_readFeatures(vdev) & TEST_F_EVENT_IDX))
+		features |= TEST_F_EVENT_IDX;
+
+	if ((err = virtio_writeFeatures(vdev, features)) < 0)
+		return err;
+
+	test_virtio_common.eventidx = (features & TEST_F_EVENT_IDX) ? 1 : 0;
+	if (eventidx && !test_virtio_common.eventidx)
+		printf("test_virtio: device doesn't offer VIRTIO_F_EVENT_IDX, notifications won't be suppressed\n");
+
+	for (i = 0; i < TEST_DEPTH; i++) {
+		if ((test_virtio_common.reqs[i] = mmap(NULL, _PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_UNCACHED, NULL, 0)) == MAP_FAILED)
+			break;
+	}
+
+	if (i < TEST_DEPTH) {
+		while (i--)
+			munmap(test_virtio_common.reqs[i], _PAGE_SIZE);
+		return -ENOMEM;
+	}
+
+	do {
+		if ((err = virtqueue_init(vdev, &test_virtio_common.vq, 0, TEST_QSIZE)) < 0)
+			break;
+
+		test_virtio_common.vdev = vdev;
+		test_virtio_common.irqs = 0;
+		if ((err = interrupt(vdev->info.irq, test_virtio_intr, NULL, test_virtio_common.cond, &test_virtio_common.inth)) < 0) {
+			virtio_reset(vdev);
+			virtqueue_destroy(vdev, &test_virtio_common.vq);
+			break;
+		}
+
+		/* Set DRIVER_OK status bit */
+		virtio_writeStatus(vdev, virtio_readStatus(vdev) | (1 << 2));
+		virtqueue_enableIRQ(vdev, &test_virtio_common.vq);
+
+		printf("test_virtio: %5s %10s %10s %10s %10s\n", "batch", "req/s", "KB/s", "kicks/1k", "irqs/1k");
+		for (i = 0; i < sizeof(batches) / sizeof(batches[0]); i++) {
+			if ((err = test_virtio_run(id, n, batches[i], sectors)) < 0)
+				break;
+		}
+
+		virtio_reset(vdev);
+		resourceDestroy(test_virtio_common.inth);
+		virtqueue_destroy(vdev, &test_virtio_common.vq);
+	} while (0);
+
+	for (i = 0; i < TEST_DEPTH; i++)
+		munmap(test_virtio_common.reqs[i], _PAGE_SIZE);
+
+	return err;
+}
+
+
+/* Initializes probed devices of selected types, runs in multiple threads */
+static void *test_virtio_initDevs(void *arg)
 {
-	virtio_dev_t vdev;
+	virtio_dev_t *vdev;
+	unsigned int i;
+	int err;
+
+	while ((i = __atomic_fetch_add(&test_virtio_common.next, 1, __ATOMIC_RELAXED)) < test_virtio_common.ndevs) {
+		vdev = &test_virtio_common.devs[i];
+
+		/* Direct MMIO descriptors get type ID during initialization (empty slots fail with -ENODEV), so they can't be deferred before it */
+		if ((test_virtio_id(vdev) != 0) && !(test_virtio_common.classes & (1UL << test_virtio_id(vdev)))) {
+			test_virtio_common.err[i] = 1;
+			continue;
+		}
+
+		if (((err = virtio_initDev(vdev)) == EOK) && !(test_virtio_common.classes & (1UL << test_virtio_id(vdev)))) {
+			virtio_destroyDev(vdev);
+			err = 1;
+		}
+		test_virtio_common.err[i] = err;
+	}
+
+	return NULL;
+}
+
+
+/* Detects VirtIO devices in the system and initializes devices of selected types, benchmarks block and entropy source devices */
+static void test_virtio_init(unsigned int bench, int eventidx, unsigned int threads)
+{
+	pthread_t tid[TEST_THREADS];
+	uint64_t start, tfind, tinit;
+	virtio_dev_t *vdev;
 	virtio_ctx_t vctx;
+	unsigned int i, n;
 	char buff[64];
-	void *base;
-	int err, i;
+	int err;
 
 	virtio_init();
 
 	printf("test_virtio: searching for VirtIO devices...\n");
+	start = bench_now();
+	test_virtio_common.ndevs = 0;
 	for (i = 0; info[i].type != vdevNONE; i++) {
 		vctx.reset = 1;
-		while ((err = virtio_find(&info[i], &vdev, &vctx)) != -ENODEV) {
+		while ((err = virtio_find(&info[i], &test_virtio_common.devs[test_virtio_common.ndevs], &vctx)) != -ENODEV) {
 			if (err < 0) {
 				printf("test_virtio: failed to process VirtIO %s ", (info[i].type == vdevPCI) ? "PCI" : "MMIO");
 				if (info[i].base.len)
@@ -199,30 +510,140 @@ static void test_virtio_init(void)
 				continue;
 			}
 
-			base = vdev.info.base.addr;
-			err = virtio_initDev(&vdev);
-			test_virtio_name(&vdev, buff);
-
-			if (err < 0) {
-				if (err != -ENODEV)
-					printf("test_virtio: failed to init %s, base: %#x\n", buff, base);
-				continue;
+			test_virtio_common.base[test_virtio_common.ndevs] = test_virtio_common.devs[test_virtio_common.ndevs].info.base.addr;
+			if (++test_virtio_common.ndevs == TEST_DEVS) {
+				printf("test_virtio: too many VirtIO devices, skipping remaining ones...\n");
+				break;
 			}
+		}
+
+		if (test_virtio_common.ndevs == TEST_DEVS)
+			break;
+	}
+	tfind = bench_now() - start;
+
+	/* Benchmarked devices have to be initialized */
+	if (bench)
+		test_virtio_common.classes |= (1UL << 0x02) | (1UL << 0x04);
 
-			printf("test_virtio: found %s, base: %#x\n", buff, base);
-			virtio_destroyDev(&vdev);
+	/* Device initialization (reset and features negotiation) runs in parallel */
+	start = bench_now();
+	test_virtio_common.next = 0;
+	for (n = 0; n + 1 < threads; n++) {
+		if (pthread_create(&tid[n], NULL, test_virtio_initDevs, NULL) != 0)
+			break;
+	}
+	test_virtio_initDevs(NULL);
+	while (n > 0)
+		pthread_join(tid[--n], NULL);
+	tinit = bench_now() - start;
+
+	for (i = 0; i < test_virtio_common.ndevs; i++) {
+		vdev = &test_virtio_common.devs[i];
+		test_virtio_name(vdev, buff);
+
+		if (test_virtio_common.err[i] > 0) {
+			printf("test_virtio: found %s, base: %#x, initialization deferred\n", buff, test_virtio_common.base[i]);
+			continue;
 		}
+
+		if (test_virtio_common.err[i] < 0) {
+			if (test_virtio_common.err[i] != -ENODEV)
+				printf("test_virtio: failed to init %s, base: %#x\n", buff, test_virtio_common.base[i]);
+			continue;
+		}
+
+		printf("test_virtio: found %s, base: %#x\n", buff, test_virtio_common.base[i]);
+
+		/* Console output would be mixed with test output, so only block and entropy source devices are benchmarked */
+		if (bench && ((test_virtio_id(vdev) == 0x02) || (test_virtio_id(vdev) == 0x04))) {
+			printf("test_virtio: starting virtqueue benchmark, %u requests per batch size...\n", bench);
+			if ((err = test_virtio_bench(vdev, test_virtio_id(vdev), bench, eventidx)) < 0)
+				printf("test_virtio: virtqueue benchmark failed, err: %d\n", err);
+		}
+
+		virtio_destroyDev(vdev);
 	}
 
+	printf("test_virtio: probed %u devices in %" PRIu64 " us (discovery %" PRIu64 " us, initialization %" PRIu64 " us, %u threads)\n",
+		test_virtio_common.ndevs, tfind + tinit, tfind, tinit, (threads > 1) ? threads : 1);
+
 	virtio_done();
 }
 
 
-int main(void)
+static void test_virtio_help(const char *prog)
+{
+	printf("Usage: %s [-b requests] [-e] [-c types] [-j threads]\n", prog);
+	printf("\t-b, --bench    - run virtqueue benchmark with given number of requests per batch size\n");
+	printf("\t-e, --eventidx - suppress notifications with event indexes (VIRTIO_F_EVENT_IDX) in benchmark\n");
+	printf("\t-c, --types    - initialize only devices of given types (hex mask, bit per device type ID), others are deferred\n");
+	printf("\t-j, --jobs     - initialize devices in given number of threads\n");
+	printf("\t-h, --help     - prints this help message\n");
+}
+
+
+int main(int argc, char *argv[])
 {
+	struct option longopts[] = {
+		{ "bench", required_argument, NULL, 'b' },
+		{ "eventidx", no_argument, NULL, 'e' },
+		{ "types", required_argument, NULL, 'c' },
+		{ "jobs", required_argument, NULL, 'j' },
+		{ "help", no_argument, NULL, 'h' },
+		{ NULL, 0, NULL, 0 }
+	};
+	unsigned int bench = 0, threads = 1;
+	int c, eventidx = 0;
+
+	test_virtio_common.classes = 0xffffffff;
+
+	while ((c = getopt_long(argc, argv, "b:ec:j:h", longopts, NULL)) != -1) {
+		switch (c) {
+			case 'b':
+				bench = atoi(optarg);
+				break;
+
+			case 'e':
+				eventidx = 1;
+				break;
+
+			case 'c':
+				test_virtio_common.classes = strtoul(optarg, NULL, 16);
+				break;
+
+			case 'j':
+				threads = atoi(optarg);
+				if (threads > TEST_THREADS)
+					threads = TEST_THREADS;
+				break;
+
+			case 'h':
+			case '?':
+			default:
+				test_virtio_help(argv[0]);
+				return EOK;
+		}
+	}
+
 	printf("test_virtio: starting, main is at %p\n", main);
 
-	test_virtio_init();
+	if (bench) {
+		if (mutexCreate(&test_virtio_common.lock) < 0)
+			return -ENOMEM;
+
+		if (condCreate(&test_virtio_common.cond) < 0) {
+			resourceDestroy(test_virtio_common.lock);
+			return -ENOMEM;
+		}
+	}
+
+	test_virtio_init(bench, eventidx, threads);
+
+	if (bench) {
+		resourceDestroy(test_virtio_common.cond);
+		resourceDestroy(test_virtio_common.lock);
+	}
 
 	return EOK;
 }
@@ -0,0 +1,468 @@
+/*
+ * Phoenix-RTOS
+ *
+ * phoenix-rtos-tests: VirtIO virtqueue notifications suppression and ring layouts tests
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "unity_fixture.h"
+
+#include "../bench_common.h"
+#include "vring.h"
+
+
+#define TEST_RING     64     /* Ring size */
+#define TEST_REQUESTS 100000 /* Requests per streaming test */
+#define TEST_BENCH    500000 /* Requests per ring layout benchmark */
+#define TEST_BATCH    32     /* Requests per batch in single thread benchmark */
+
+
+static struct {
+	vring_t vr;
+	vring_packed_t packed;
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	unsigned int kicks;      /* Driver notifications */
+	unsigned int irqs;       /* Device interrupts */
+	unsigned int adds;       /* Driver notification opportunities */
+	unsigned int pushes;     /* Device interrupt opportunities */
+	int stop;
+	unsigned char *seen;     /* Completed requests */
+} vring_common;
+
+
+/* Emulated device, completes requests one by one */
+static void *test_device(void *arg)
+{
+	vring_t *vr = arg;
+	unsigned int kicks = 0;
+	int id;
+
+	for (;;) {
+		vring_busy(vr);
+		while ((id = vring_pop(vr)) >= 0) {
+			/* Return request sequence number as used length */
+			vring_push(vr, id, (uint32_t)vr->desc[id].addr);
+			vring_common.pushes++;
+
+			if (vring_signal(vr)) {
+				pthread_mutex_lock(&vring_common.lock);
+				vring_common.irqs++;
+				pthread_cond_broadcast(&vring_common.cond);
+				pthread_mutex_unlock(&vring_common.lock);
+			}
+		}
+
+		if (vring_wait(vr))
+			continue;
+
+		pthread_mutex_lock(&vring_common.lock);
+		while (!vring_common.stop && (vring_common.kicks == kicks))
+			pthread_cond_wait(&vring_common.cond, &vring_common.lock);
+		kicks = vring_common.kicks;
+		pthread_mutex_unlock(&vring_common.lock);
+
+		if (vring_common.stop)
+			break;
+	}
+
+	return NULL;
+}
+
+
+/* Streams n requests through ring, interrupts are requested after coalesce completions. Returns number of completed requests */
+static unsigned int test_stream(unsigned int n, unsigned int coalesce)
+{
+	unsigned int submitted = 0, done = 0, irqs, inflight;
+	struct timespec ts;
+	uint32_t len;
+	int id, err = 0;
+
+	vring_disarm(&vring_common.vr);
+
+	while ((err == 0) && (done < n)) {
+		while ((submitted < n) && (vring_add(&vring_common.vr, submitted, 512, VRING_DESC_F_WRITE) >= 0)) {
+			submitted++;
+			vring_common.adds++;
+
+			if (vring_kick(&vring_common.vr)) {
+				pthread_mutex_lock(&vring_common.lock);
+				vring_common.kicks++;
+				pthread_cond_broadcast(&vring_common.cond);
+				pthread_mutex_unlock(&vring_common.lock);
+			}
+		}
+
+		inflight = submitted - done;
+		while ((id = vring_get(&vring_common.vr, &len)) >= 0) {
+			if ((len >= n) || vring_common.seen[len]++)
+				return done;
+			done++;
+		}
+
+		if (submitted - done < inflight)
+			continue;
+
+		/* Nothing completed, wait for interrupt */
+		pthread_mutex_lock(&vring_common.lock);
+		irqs = vring_common.irqs;
+		if (!vring_arm(&vring_common.vr, (inflight < coalesce) ? inflight : coalesce)) {
+			clock_gettime(CLOCK_REALTIME, &ts);
+			ts.tv_sec += 2;
+			while ((err == 0) && (vring_common.irqs == irqs))
+				err = pthread_cond_timedwait(&vring_common.cond, &vring_common.lock, &ts);
+		}
+		pthread_mutex_unlock(&vring_common.lock);
+		vring_disarm(&vring_common.vr);
+	}
+
+	return done;
+}
+
+
+static void test_run(int eventidx, unsigned int coalesce)
+{
+	pthread_t device;
+	unsigned int done;
+
+	TEST_ASSERT_EQUAL_INT(0, vring_init(&vring_common.vr, TEST_RING, eventidx));
+	vring_common.kicks = 0;
+	vring_common.irqs = 0;
+	vring_common.adds = 0;
+	vring_common.pushes = 0;
+	vring_common.stop = 0;
+	memset(vring_common.seen, 0, TEST_REQUESTS);
+
+	TEST_ASSERT_EQUAL_INT(0, pthread_create(&device, NULL, test_device, &vring_common.vr));
+	done = test_stream(TEST_REQUESTS, coalesce);
+
+	pthread_mutex_lock(&vring_common.lock);
+	vring_common.stop = 1;
+	pthread_cond_broadcast(&vring_common.cond);
+	pthread_mutex_unlock(&vring_common.lock);
+	pthread_join(device, NULL);
+
+	printf("test_vring: %-9s coalesce %2u: kicks %4u/1k (%u saved), irqs %4u/1k (%u saved)\n", eventidx ? "event idx" : "flags", coalesce,
+		(unsigned int)((uint64_t)vring_common.kicks * 1000 / TEST_REQUESTS), vring_common.adds - vring_common.kicks,
+		(unsigned int)((uint64_t)vring_common.irqs * 1000 / TEST_REQUESTS), vring_common.pushes - vring_common.irqs);
+
+	vring_done(&vring_common.vr);
+
+	/* No completion lost or duplicated */
+	TEST_ASSERT_EQUAL_UINT(TEST_REQUESTS, done);
+	TEST_ASSERT_EACH_EQUAL_UINT8(1, vring_common.seen, TEST_REQUESTS);
+}
+
+
+/*
+ * Split and packed rings benchmark
+ */
+
+
+/* Emulated device polling split ring */
+static void *test_splitDevice(void *arg)
+{
+	vring_t *vr = arg;
+	int id;
+
+	while (!__atomic_load_n(&vring_common.stop, __ATOMIC_RELAXED)) {
+		if ((id = vring_pop(vr)) < 0) {
+			sched_yield();
+			continue;
+		}
+		vring_push(vr, id, vr->desc[id].len);
+	}
+
+	return NULL;
+}
+
+
+/* Emulated device polling packed ring */
+static void *test_packedDevice(void *arg)
+{
+	vring_packed_t *vr = arg;
+	uint32_t len;
+	int id;
+
+	while (!__atomic_load_n(&vring_common.stop, __ATOMIC_RELAXED)) {
+		if ((id = vring_packedPop(vr, NULL, &len)) < 0) {
+			sched_yield();
+			continue;
+		}
+		vring_packedPush(vr, id, len);
+	}
+
+	return NULL;
+}
+
+
+/* Processes n requests through split (packed == 0) or packed ring, device runs in separate thread if threaded, returns time in usec */
+static uint64_t test_layout(int packed, int threaded, unsigned int n)
+{
+	vring_t *split = &vring_common.vr;
+	vring_packed_t *pvr = &vring_common.packed;
+	unsigned int submitted = 0, done = 0, i, k;
+	uint64_t start;
+	pthread_t device;
+	uint32_t len = 0;
+	int id, progress;
+
+	if (packed)
+		TEST_ASSERT_EQUAL_INT(0, vring_packedInit(pvr, TEST_RING));
+	else
+		TEST_ASSERT_EQUAL_INT(0, vring_init(split, TEST_RING, 0));
+
+	vring_common.stop = 0;
+	if (threaded)
+		TEST_ASSERT_EQUAL_INT(0, pthread_create(&device, NULL, packed ? test_packedDevice : test_splitDevice, packed ? (void *)pvr : (void *)split));
+
+	start = bench_now();
+	while (done < n) {
+		progress = 0;
+		for (k = 0; (k < TEST_BATCH) && (submitted < n); k++, submitted++) {
+			if ((packed ? vring_packedAdd(pvr, submitted, 512, VRING_DESC_F_WRITE) : vring_add(split, submitted, 512, VRING_DESC_F_WRITE)) < 0)
+				break;
+			progress = 1;
+		}
+
+		/* Device processing in the same thread */
+		if (!threaded) {
+			for (i = 0; i < k; i++) {
+				if (packed) {
+					id = vring_packedPop(pvr, NULL, &len);
+					vring_packedPush(pvr, id, len);
+				}
+				else {
+					id = vring_pop(split);
+					vring_push(split, id, split->desc[id].len);
+				}
+			}
+		}
+
+		while ((packed ? vring_packedGet(pvr, &len) : vring_get(split, &len)) >= 0) {
+			done++;
+			progress = 1;
+		}
+
+		if (!progress)
+			sched_yield();
+	}
+	start = bench_now() - start;
+
+	if (threaded) {
+		__atomic_store_n(&vring_common.stop, 1, __ATOMIC_RELAXED);
+		pthread_join(device, NULL);
+	}
+
+	if (packed)
+		vring_packedDone(pvr);
+	else
+		vring_done(split);
+
+	return start;
+}
+
+
+TEST_GROUP(vring);
+
+
+TEST_SETUP(vring)
+{
+	vring_common.seen = malloc(TEST_REQUESTS);
+	TEST_ASSERT_NOT_NULL(vring_common.seen);
+}
+
+
+TEST_TEAR_DOWN(vring)
+{
+	free(vring_common.seen);
+}
+
+
+TEST(vring, needevent)
+{
+	TEST_ASSERT_TRUE(vring_needEvent(0, 1, 0));
+	TEST_ASSERT_FALSE(vring_needEvent(5, 5, 4));
+	TEST_ASSERT_TRUE(vring_needEvent(5, 6, 4));
+	TEST_ASSERT_FALSE(vring_needEvent(10, 20, 15));
+	TEST_ASSERT_FALSE(vring_needEvent(10, 10, 10));
+
+	/* Index wrap-around */
+	TEST_ASSERT_TRUE(vring_needEvent(0xffff, 1, 0xfffe));
+	TEST_ASSERT_TRUE(vring_needEvent(0, 2, 0xffff));
+	TEST_ASSERT_FALSE(vring_needEvent(3, 2, 0xffff));
+}
+
+
+/* Device isn't notified about buffers added while it's busy */
+TEST(vring, suppress)
+{
+	vring_t *vr = &vring_common.vr;
+
+	TEST_ASSERT_EQUAL_INT(0, vring_init(vr, 8, 1));
+
+	TEST_ASSERT_FALSE(vring_wait(vr));
+	TEST_ASSERT_EQUAL_INT(0, vring_add(vr, 0, 0, 0) < 0);
+	TEST_ASSERT_TRUE(vring_kick(vr));
+	TEST_ASSERT_EQUAL_INT(0, vring_add(vr, 1, 0, 0) < 0);
+	TEST_ASSERT_FALSE(vring_kick(vr));
+
+	/* Device consumes both buffers, then waits */
+	TEST_ASSERT_TRUE(vring_pop(vr) >= 0);
+	TEST_ASSERT_TRUE(vring_pop(vr) >= 0);
+	TEST_ASSERT_TRUE(vring_pop(vr) < 0);
+	TEST_ASSERT_FALSE(vring_wait(vr));
+
+	TEST_ASSERT_EQUAL_INT(0, vring_add(vr, 2, 0, 0) < 0);
+	TEST_ASSERT_TRUE(vring_kick(vr));
+
+	/* Buffer added before device waits isn't lost */
+	TEST_ASSERT_EQUAL_INT(0, vring_add(vr, 3, 0, 0) < 0);
+	TEST_ASSERT_FALSE(vring_kick(vr));
+	TEST_ASSERT_TRUE(vring_wait(vr));
+
+	vring_done(vr);
+}
+
+
+/* Single interrupt for whole batch of completions */
+TEST(vring, coalesce)
+{
+	vring_t *vr = &vring_common.vr;
+	unsigned int i;
+	int ids[16];
+
+	TEST_ASSERT_EQUAL_INT(0, vring_init(vr, 16, 1));
+
+	for (i = 0; i < 16; i++)
+		TEST_ASSERT_EQUAL_INT(0, vring_add(vr, i, 0, 0) < 0);
+	TEST_ASSERT_FALSE(vring_arm(vr, 16));
+
+	for (i = 0; i < 16; i++) {
+		TEST_ASSERT_TRUE((ids[i] = vring_pop(vr)) >= 0);
+		vring_push(vr, ids[i], i);
+		TEST_ASSERT_EQUAL_INT(i == 15, vring_signal(vr));
+	}
+
+	for (i = 0; i < 16; i++)
+		TEST_ASSERT_EQUAL_INT(ids[i], vring_get(vr, NULL));
+	TEST_ASSERT_EQUAL_INT(-1, vring_get(vr, NULL));
+
+	vring_done(vr);
+}
+
+
+/* Buffers are returned through packed ring across many ring wraps, also out of order */
+TEST(vring, packed)
+{
+	vring_packed_t *vr = &vring_common.packed;
+	unsigned int i, j, k, n = 0, seq = 0;
+	int ids[6];
+	uint64_t addr;
+	uint32_t len;
+
+	/* Size not being power of 2 is allowed for packed rings */
+	TEST_ASSERT_EQUAL_INT(0, vring_packedInit(vr, 6));
+
+	for (i = 0; i < 1000; i++) {
+		k = 1 + i % 6;
+		for (j = 0; j < k; j++)
+			TEST_ASSERT_TRUE(vring_packedAdd(vr, seq + j, 0, VRING_DESC_F_WRITE) >= 0);
+		if (k == 6)
+			TEST_ASSERT_EQUAL_INT(-1, vring_packedAdd(vr, 0, 0, 0));
+
+		/* Device sees buffers in order */
+		for (j = 0; j < k; j++) {
+			TEST_ASSERT_TRUE((ids[j] = vring_packedPop(vr, &addr, &len)) >= 0);
+			TEST_ASSERT_EQUAL_UINT64(seq + j, addr);
+		}
+		TEST_ASSERT_EQUAL_INT(-1, vring_packedPop(vr, NULL, NULL));
+
+		/* Completes them in reverse order */
+		for (j = k; j-- > 0;)
+			vring_packedPush(vr, ids[j], seq + j);
+
+		for (j = k; j-- > 0;) {
+			TEST_ASSERT_EQUAL_INT(ids[j], vring_packedGet(vr, &len));
+			TEST_ASSERT_EQUAL_UINT32(seq + j, len);
+			n++;
+		}
+		TEST_ASSERT_EQUAL_INT(-1, vring_packedGet(vr, NULL));
+
+		seq += k;
+	}
+
+	TEST_ASSERT_EQUAL_UINT(seq, n);
+	vring_packedDone(vr);
+}
+
+
+/* Streaming workload with emulated device, no completion may be lost */
+TEST(vring, stream)
+{
+	test_run(0, 1);
+	test_run(1, 1);
+	test_run(1, TEST_RING / 4);
+}
+
+
+/* Descriptor processing rate of split and packed rings */
+TEST(vring, layouts)
+{
+	uint64_t t[2][2];
+	int packed, threaded;
+
+	for (threaded = 0; threaded < 2; threaded++) {
+		for (packed = 0; packed < 2; packed++)
+			t[threaded][packed] = test_layout(packed, threaded, TEST_BENCH);
+	}
+
+	printf("test_vring: ring of %u descriptors, split %zu bytes, packed %zu bytes\n", TEST_RING,
+		TEST_RING * sizeof(vring_desc_t) + 2 * (3 + TEST_RING) + 2 * 3 + TEST_RING * sizeof(vring_used_elem_t), TEST_RING * sizeof(vring_packed_desc_t));
+	printf("test_vring: single thread split %" PRIu64 " req/s, packed %" PRIu64 " req/s\n", bench_rate(TEST_BENCH, t[0][0]), bench_rate(TEST_BENCH, t[0][1]));
+	printf("test_vring: device thread split %" PRIu64 " req/s, packed %" PRIu64 " req/s\n", bench_rate(TEST_BENCH, t[1][0]), bench_rate(TEST_BENCH, t[1][1]));
+}
+
+
+TEST_GROUP_RUNNER(vring)
+{
+	pthread_mutex_init(&vring_common.lock, NULL);
+	pthread_cond_init(&vring_common.cond, NULL);
+
+	RUN_TEST_CASE(vring, needevent);
+	RUN_TEST_CASE(vring, suppress);
+	RUN_TEST_CASE(vring, coalesce);
+	RUN_TEST_CASE(vring, stream);
+	RUN_TEST_CASE(vring, packed);
+	RUN_TEST_CASE(vring, layouts);
+
+	pthread_cond_destroy(&vring_common.cond);
+	pthread_mutex_destroy(&vring_common.lock);
+}
+
+
+void runner(void)
+{
+	RUN_TEST_GROUP(vring);
+}
+
+
+int main(int argc, char *argv[])
+{
+	UnityMain(argc, (const char **)argv, runner);
+	return 0;
+}
@@ -0,0 +1,466 @@
+/*
+ * Phoenix-RTOS
+ *
+ * phoenix-rtos-tests
+ *
+ * VirtIO virtqueue models:
+ * vring_t        - split virtqueue with notifications suppression (VIRTIO_F_EVENT_IDX)
+ * vring_packed_t - packed virtqueue (VIRTIO_F_RING_PACKED, virtio 1.1)
+ *
+ * Both driver and device sides of the ring live in memory, so the ring protocols
+ * can be tested and benchmarked without a hypervisor. Each request uses a single
+ * descriptor.
+ *
+ * Copyright 2021 Phoenix Systems
+ *
+ * This file is part of Phoenix-RTOS.
+ *
+ * %LICENSE%
+ */
+
+#ifndef VRING_H
+#define VRING_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+
+#define VRING_DESC_F_WRITE     0x2 /* Buffer is device write-only */
+#define VRING_USED_F_NO_NOTIFY 0x1 /* Device doesn't need driver notifications */
+#define VRING_AVAIL_F_NO_IRQ   0x1 /* Driver doesn't need device interrupts */
+
+#define VRING_PACKED_F_AVAIL (1 << 7)  /* Packed descriptor available flag */
+#define VRING_PACKED_F_USED  (1 << 15) /* Packed descriptor used flag */
+
+
+typedef struct {
+	uint64_t addr;
+	uint32_t len;
+	uint16_t flags;
+	uint16_t next;
+} vring_desc_t;
+
+
+typedef struct {
+	uint32_t id;
+	uint32_t len;
+} vring_used_elem_t;
+
+
+/* Packed ring descriptor, written back by device when used */
+typedef struct {
+	uint64_t addr;
+	uint32_t len;
+	uint16_t id;
+	uint16_t flags;
+} vring_packed_desc_t;
+
+
+typedef struct {
+	unsigned int size;                   /* Number of descriptors, power of 2 */
+	int eventidx;                        /* VIRTIO_F_EVENT_IDX negotiated */
+	void *mem;
+
+	/* Shared ring */
+	vring_desc_t *desc;
+	volatile uint16_t *avail;            /* flags, idx, ring[size], used_event */
+	volatile uint16_t *used;             /* flags, idx, then used elements */
+	volatile vring_used_elem_t *ring;    /* Used ring elements */
+	volatile uint16_t *uevent;           /* used_event, written by driver */
+	volatile uint16_t *aevent;           /* avail_event, written by device */
+
+	/* Driver state */
+	uint16_t *free;                      /* Free descriptors stack */
+	unsigned int nfree;
+	uint16_t last;                       /* Next used element to process */
+	uint16_t kicked;                     /* Available index at last notification */
+
+	/* Device state */
+	uint16_t dlast;                      /* Next available element to process */
+	uint16_t signalled;                  /* Used index at last interrupt */
+} vring_t;
+
+
+typedef struct {
+	unsigned int size;                   /* Number of descriptors */
+	volatile vring_packed_desc_t *desc;  /* Descriptors ring, shared */
+
+	/* Driver state */
+	uint16_t *free;                      /* Free buffer IDs stack */
+	unsigned int nfree;
+	uint16_t next;                       /* Next descriptor to make available */
+	uint16_t last;                       /* Next descriptor to check for used buffer */
+	uint8_t wrap;                        /* Driver ring wrap counter */
+	uint8_t uwrap;                       /* Used ring wrap counter */
+
+	/* Device state */
+	uint16_t dnext;                      /* Next descriptor to check for available buffer */
+	uint16_t dlast;                      /* Next descriptor to write used buffer to */
+	uint8_t dwrap;                       /* Device available ring wrap counter */
+	uint8_t dpwrap;                      /* Device used ring wrap counter */
+} vring_packed_t;
+
+
+/* Returns non-zero if event index was crossed when index moved from old to new (virtio spec vring_need_event) */
+static inline int vring_needEvent(uint16_t event, uint16_t new, uint16_t old)
+{
+	return (uint16_t)(new - event - 1) < (uint16_t)(new - old);
+}
+
+
+static inline void vring_barrier(void)
+{
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+
+static inline void vring_done(vring_t *vr)
+{
+	free(vr->free);
+	free(vr->mem);
+}
+
+
+/* Allocates ring of size descriptors (power of 2) */
+static inline int vring_init(vring_t *vr, unsigned int size, int eventidx)
+{
+	unsigned int i;
+	size_t offs;
+
+	if ((size == 0) || (size > 32768) || (size & (size - 1)))
+		return -1;
+
+	/* Descriptors, available ring and used ring (aligned to 4 bytes) */
+	offs = ((16 * size + 2 * (3 + size)) + 3) & ~(size_t)3;
+
+	vr->size = size;
+	vr->eventidx = eventidx;
+	vr->mem = calloc(1, offs + 4 * 2 + 8 * size);
+	vr->free = malloc(size * sizeof(*vr->free));
+
+	if ((vr->mem == NULL) || (vr->free == NULL)) {
+		vring_done(vr);
+		return -1;
+	}
+
+	vr->desc = vr->mem;
+	vr->avail = (uint16_t *)((uint8_t *)vr->mem + 16 * size);
+	vr->uevent = &vr->avail[2 + size];
+	vr->used = (uint16_t *)((uint8_t *)vr->mem + offs);
+	vr->ring = (vring_used_elem_t *)&vr->used[2];
+	vr->aevent = (uint16_t *)&vr->ring[size];
+
+	for (i = 0; i < size; i++)
+		vr->free[i] = size - i - 1;
+	vr->nfree = size;
+	vr->last = 0;
+	vr->kicked = 0;
+	vr->dlast = 0;
+	vr->signalled = 0;
+
+	return 0;
+}
+
+
+/*
+ * Driver side
+ */
+
+
+/* Makes buffer available to device, returns request ID or -1 if ring is full */
+static inline int vring_add(vring_t *vr, uint64_t addr, uint32_t len, uint16_t flags)
+{
+	uint16_t id, idx;
+
+	if (vr->nfree == 0)
+		return -1;
+
+	id = vr->free[--vr->nfree];
+	vr->desc[id].addr = addr;
+	vr->desc[id].len = len;
+	vr->desc[id].flags = flags;
+
+	idx = vr->avail[1];
+	vr->avail[2 + (idx & (vr->size - 1))] = id;
+	__atomic_store_n(&vr->avail[1], (uint16_t)(idx + 1), __ATOMIC_RELEASE);
+
+	return id;
+}
+
+
+/* Returns non-zero if device has to be notified about buffers added since last notification */
+static inline int vring_kick(vring_t *vr)
+{
+	uint16_t old = vr->kicked, new = vr->avail[1];
+
+	/* Order available index store before reading device event */
+	vring_barrier();
+	vr->kicked = new;
+
+	if (old == new)
+		return 0;
+
+	if (vr->eventidx)
+		return vring_needEvent(__atomic_load_n(vr->aevent, __ATOMIC_RELAXED), new, old);
+
+	return !(__atomic_load_n(&vr->used[0], __ATOMIC_RELAXED) & VRING_USED_F_NO_NOTIFY);
+}
+
+
+/* Returns ID of next completed request or -1 */
+static inline int vring_get(vring_t *vr, uint32_t *len)
+{
+	uint16_t id;
+
+	if (vr->last == __atomic_load_n(&vr->used[1], __ATOMIC_ACQUIRE))
+		return -1;
+
+	id = vr->ring[vr->last & (vr->size - 1)].id;
+	if (len != NULL)
+		*len = vr->ring[vr->last & (vr->size - 1)].len;
+	vr->last++;
+	vr->free[vr->nfree++] = id;
+
+	return id;
+}
+
+
+/*
+ * Requests interrupt after n more completions (interrupt coalescing), n = 1 requests interrupt on next completion.
+ * Returns non-zero if completions arrived in the meantime and interrupt might have been missed.
+ */
+static inline int vring_arm(vring_t *vr, unsigned int n)
+{
+	if (vr->eventidx)
+		__atomic_store_n(vr->uevent, (uint16_t)(vr->last + n - 1), __ATOMIC_RELAXED);
+	else
+		__atomic_store_n(&vr->avail[0], 0, __ATOMIC_RELAXED);
+
+	vring_barrier();
+
+	return (vr->last != __atomic_load_n(&vr->used[1], __ATOMIC_RELAXED));
+}
+
+
+/* Disables interrupts (best effort, device may still interrupt) */
+static inline void vring_disarm(vring_t *vr)
+{
+	if (vr->eventidx)
+		__atomic_store_n(vr->uevent, (uint16_t)(vr->last - 1), __ATOMIC_RELAXED);
+	else
+		__atomic_store_n(&vr->avail[0], VRING_AVAIL_F_NO_IRQ, __ATOMIC_RELAXED);
+}
+
+
+/*
+ * Device side
+ */
+
+
+/* Returns ID of next available request or -1 */
+static inline int vring_pop(vring_t *vr)
+{
+	uint16_t id;
+
+	if (vr->dlast == __atomic_load_n(&vr->avail[1], __ATOMIC_ACQUIRE))
+		return -1;
+
+	id = vr->avail[2 + (vr->dlast & (vr->size - 1))];
+	vr->dlast++;
+
+	return id;
+}
+
+
+/* Returns used buffer to driver */
+static inline void vring_push(vring_t *vr, uint16_t id, uint32_t len)
+{
+	uint16_t idx = vr->used[1];
+
+	vr->ring[idx & (vr->size - 1)].id = id;
+	vr->ring[idx & (vr->size - 1)].len = len;
+	__atomic_store_n(&vr->used[1], (uint16_t)(idx + 1), __ATOMIC_RELEASE);
+}
+
+
+/* Returns non-zero if driver has to be interrupted about buffers used since last interrupt */
+static inline int vring_signal(vring_t *vr)
+{
+	uint16_t old = vr->signalled, new = vr->used[1];
+
+	/* Order used index store before reading driver event */
+	vring_barrier();
+	vr->signalled = new;
+
+	if (old == new)
+		return 0;
+
+	if (vr->eventidx)
+		return vring_needEvent(__atomic_load_n(vr->uevent, __ATOMIC_RELAXED), new, old);
+
+	return !(__atomic_load_n(&vr->avail[0], __ATOMIC_RELAXED) & VRING_AVAIL_F_NO_IRQ);
+}
+
+
+/* Requests notification about next available buffer, returns non-zero if buffers arrived in the meantime */
+static inline int vring_wait(vring_t *vr)
+{
+	if (vr->eventidx)
+		__atomic_store_n(vr->aevent, vr->dlast, __ATOMIC_RELAXED);
+	else
+		__atomic_store_n(&vr->used[0], 0, __ATOMIC_RELAXED);
+
+	vring_barrier();
+
+	return (vr->dlast != __atomic_load_n(&vr->avail[1], __ATOMIC_RELAXED));
+}
+
+
+/* Disables driver notifications while device processes buffers */
+static inline void vring_busy(vring_t *vr)
+{
+	if (!vr->eventidx)
+		__atomic_store_n(&vr->used[0], VRING_USED_F_NO_NOTIFY, __ATOMIC_RELAXED);
+}
+
+
+/*
+ * Packed virtqueue
+ *
+ * Driver makes descriptors available in ring order, device writes used descriptors
+ * back in place (in order of completion), so both sides touch the same cache lines
+ * and there are no separate index structures to share.
+ */
+
+
+static inline void vring_packedDone(vring_packed_t *vr)
+{
+	free(vr->free);
+	free((void *)vr->desc);
+}
+
+
+static inline int vring_packedInit(vring_packed_t *vr, unsigned int size)
+{
+	unsigned int i;
+
+	if ((size == 0) || (size > 32768))
+		return -1;
+
+	vr->size = size;
+	vr->desc = calloc(size, sizeof(*vr->desc));
+	vr->free = malloc(size * sizeof(*vr->free));
+
+	if ((vr->desc == NULL) || (vr->free == NULL)) {
+		vring_packedDone(vr);
+		return -1;
+	}
+
+	for (i = 0; i < size; i++)
+		vr->free[i] = size - i - 1;
+	vr->nfree = size;
+	vr->next = 0;
+	vr->last = 0;
+	vr->wrap = 1;
+	vr->uwrap = 1;
+	vr->dnext = 0;
+	vr->dlast = 0;
+	vr->dwrap = 1;
+	vr->dpwrap = 1;
+
+	return 0;
+}
+
+
+/* Makes buffer available to device, returns buffer ID or -1 if ring is full */
+static inline int vring_packedAdd(vring_packed_t *vr, uint64_t addr, uint32_t len, uint16_t flags)
+{
+	volatile vring_packed_desc_t *desc = &vr->desc[vr->next];
+	uint16_t id;
+
+	if (vr->nfree == 0)
+		return -1;
+
+	id = vr->free[--vr->nfree];
+	desc->addr = addr;
+	desc->len = len;
+	desc->id = id;
+
+	/* Avail flag equal to wrap counter, used flag inverted */
+	flags |= vr->wrap ? VRING_PACKED_F_AVAIL : VRING_PACKED_F_USED;
+	__atomic_store_n(&desc->flags, flags, __ATOMIC_RELEASE);
+
+	if (++vr->next == vr->size) {
+		vr->next = 0;
+		vr->wrap ^= 1;
+	}
+
+	return id;
+}
+
+
+/* Returns ID of next used buffer or -1 */
+static inline int vring_packedGet(vring_packed_t *vr, uint32_t *len)
+{
+	volatile vring_packed_desc_t *desc = &vr->desc[vr->last];
+	uint16_t flags = __atomic_load_n(&desc->flags, __ATOMIC_ACQUIRE), id;
+
+	/* Both flags equal to used wrap counter */
+	if ((!!(flags & VRING_PACKED_F_USED) != vr->uwrap) || (!!(flags & VRING_PACKED_F_AVAIL) != vr->uwrap))
+		return -1;
+
+	id = desc->id;
+	if (len != NULL)
+		*len = desc->len;
+	vr->free[vr->nfree++] = id;
+
+	if (++vr->last == vr->size) {
+		vr->last = 0;
+		vr->uwrap ^= 1;
+	}
+
+	return id;
+}
+
+
+/* Returns ID of next available buffer or -1, buffer address and length are returned in addr and len */
+static inline int vring_packedPop(vring_packed_t *vr, uint64_t *addr, uint32_t *len)
+{
+	volatile vring_packed_desc_t *desc = &vr->desc[vr->dnext];
+	uint16_t flags = __atomic_load_n(&desc->flags, __ATOMIC_ACQUIRE), id;
+
+	if ((!!(flags & VRING_PACKED_F_AVAIL) != vr->dwrap) || (!!(flags & VRING_PACKED_F_USED) == vr->dwrap))
+		return -1;
+
+	id = desc->id;
+	if (addr != NULL)
+		*addr = desc->addr;
+	if (len != NULL)
+		*len = desc->len;
+
+	if (++vr->dnext == vr->size) {
+		vr->dnext = 0;
+		vr->dwrap ^= 1;
+	}
+
+	return id;
+}
+
+
+/* Writes used buffer back to ring */
+static inline void vring_packedPush(vring_packed_t *vr, uint16_t id, uint32_t len)
+{
+	volatile vring_packed_desc_t *desc = &vr->desc[vr->dlast];
+
+	desc->id = id;
+	desc->len = len;
+	__atomic_store_n(&desc->flags, vr->dpwrap ? (VRING_PACKED_F_AVAIL | VRING_PACKED_F_USED) : 0, __ATOMIC_RELEASE);
+
+	if (++vr->dlast == vr->size) {
+		vr->dlast = 0;
+		vr->dpwrap ^= 1;
+	}
+}
+
+
+#endif